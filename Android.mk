@@ -18,6 +18,7 @@ zlib_files := \
 	src/inflate.c \
 	src/inftrees.c \
 	src/inffast.c \
+	src/train.c \
 	src/trees.c \
 	src/uncompr.c \
 	src/zutil.c
@@ -103,3 +104,16 @@ LOCAL_STATIC_LIBRARIES := libz
 LOCAL_CXX_STL := none
 
 include $(BUILD_HOST_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_SRC_FILES:=        \
+	src/test/minidict.c
+
+LOCAL_MODULE:= minidict
+
+LOCAL_STATIC_LIBRARIES := libz
+
+LOCAL_CXX_STL := none
+
+include $(BUILD_HOST_EXECUTABLE)
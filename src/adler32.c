@@ -10,6 +10,7 @@
 #define local static
 
 local uLong adler32_combine_ OF((uLong adler1, uLong adler2, z_off64_t len2));
+local uLong adler32_combine_gen_ OF((z_off64_t len2));
 
 #define BASE 65521      /* largest prime smaller than 65536 */
 #define NMAX 5552
@@ -133,22 +134,46 @@ uLong ZEXPORT adler32(adler, buf, len)
 }
 
 /* ========================================================================= */
-local uLong adler32_combine_(adler1, adler2, len2)
+#define COPY_PIECE 4096     /* copied pieces stay in the level one cache */
+
+uLong ZEXPORT adler32_copy(adler, dst, buf, len)
+    uLong adler;
+    Bytef *dst;
+    const Bytef *buf;
+    uInt len;
+{
+    uInt n;
+
+    if (buf == Z_NULL)
+        return 1L;
+
+    while (len) {
+        n = len < COPY_PIECE ? len : COPY_PIECE;
+        zmemcpy(dst, buf, n);
+        adler = adler32(adler, dst, n);
+        dst += n;
+        buf += n;
+        len -= n;
+    }
+    return adler;
+}
+
+/* ========================================================================= */
+uLong ZEXPORT adler32_combine_op(adler1, adler2, op)
     uLong adler1;
     uLong adler2;
-    z_off64_t len2;
+    uLong op;
 {
     unsigned long sum1;
     unsigned long sum2;
     unsigned rem;
 
-    /* for negative len, return invalid adler32 as a clue for debugging */
-    if (len2 < 0)
+    /* for an invalid op, return invalid adler32 as a clue for debugging */
+    if (op >= BASE)
         return 0xffffffffUL;
 
     /* the derivation of this formula is left as an exercise for the reader */
-    MOD63(len2);                /* assumes len2 >= 0 */
-    rem = (unsigned)len2;
+    rem = (unsigned)op;
     sum1 = adler1 & 0xffff;
     sum2 = rem * sum1;
     MOD(sum2);
@@ -161,6 +186,26 @@ local uLong adler32_combine_(adler1, adler2, len2)
     return sum1 | (sum2 << 16);
 }
 
+/* ========================================================================= */
+local uLong adler32_combine_gen_(len2)
+    z_off64_t len2;
+{
+    /* for negative len, return an invalid op */
+    if (len2 < 0)
+        return BASE;
+    MOD63(len2);                /* assumes len2 >= 0 */
+    return (uLong)len2;
+}
+
+/* ========================================================================= */
+local uLong adler32_combine_(adler1, adler2, len2)
+    uLong adler1;
+    uLong adler2;
+    z_off64_t len2;
+{
+    return adler32_combine_op(adler1, adler2, adler32_combine_gen_(len2));
+}
+
 /* ========================================================================= */
 uLong ZEXPORT adler32_combine(adler1, adler2, len2)
     uLong adler1;
@@ -177,3 +222,16 @@ uLong ZEXPORT adler32_combine64(adler1, adler2, len2)
 {
     return adler32_combine_(adler1, adler2, len2);
 }
+
+/* ========================================================================= */
+uLong ZEXPORT adler32_combine_gen(len2)
+    z_off_t len2;
+{
+    return adler32_combine_gen_(len2);
+}
+
+uLong ZEXPORT adler32_combine_gen64(len2)
+    z_off64_t len2;
+{
+    return adler32_combine_gen_(len2);
+}
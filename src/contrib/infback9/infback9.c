@@ -7,6 +7,7 @@
 #include "infback9.h"
 #include "inftree9.h"
 #include "inflate9.h"
+#include "inffast9.h"
 
 #define WSIZE 65536UL
 
@@ -113,6 +114,33 @@ void makefixed9(void)
 
 /* Macros for inflateBack(): */
 
+/* Load returned state from inflate_fast9() */
+#define LOAD() \
+    do { \
+        put = strm->next_out; \
+        left = strm->avail_out; \
+        next = strm->next_in; \
+        have = strm->avail_in; \
+        hold = state->hold; \
+        bits = state->bits; \
+    } while (0)
+
+/* Set state from registers for inflate_fast9() */
+#define RESTORE() \
+    do { \
+        strm->next_out = put; \
+        strm->avail_out = (uInt)left; \
+        strm->next_in = next; \
+        strm->avail_in = have; \
+        state->hold = hold; \
+        state->bits = bits; \
+        state->wrap = wrap; \
+        state->lencode = lencode; \
+        state->distcode = distcode; \
+        state->lenbits = lenbits; \
+        state->distbits = distbits; \
+    } while (0)
+
 /* Clear the input bit accumulator */
 #define INITBITS() \
     do { \
@@ -465,6 +493,15 @@ void FAR *out_desc;
             mode = LEN;
 
         case LEN:
+            /* use inflate_fast9() if we have enough input and output, then
+               decode one code here if it stopped in the middle of a block */
+            if (have >= 7 && left >= 258) {
+                RESTORE();
+                mode = inflate_fast9(strm);
+                LOAD();
+                if (mode != LEN) break;
+            }
+
             /* get a literal, length, or end-of-block code */
             for (;;) {
                 here = lencode[BITS(lenbits)];
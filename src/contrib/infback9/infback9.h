@@ -6,14 +6,17 @@
 /*
  * This header file and associated patches provide a decoder for PKWare's
  * undocumented deflate64 compression method (method 9).  Use with infback9.c,
- * inftree9.h, inftree9.c, and inffix9.h.  These patches are not supported.
+ * inftree9.h, inftree9.c, inffast9.h, inffast9.c, and inffix9.h.  These
+ * patches are not supported.
  * This should be compiled with zlib, since it uses zutil.h and zutil.o.
  * This code has not yet been tested on 16-bit architectures.  See the
  * comments in zlib.h for inflateBack() usage.  These functions are used
  * identically, except that there is no windowBits parameter, and a 64K
  * window must be provided.  Also if int's are 16 bits, then a zero for
  * the third parameter of the "out" function actually means 65536UL.
- * zlib.h must be included before this header file.
+ * zlib.h must be included before this header file.  deflate64 data can be
+ * produced by deflate() if zlib is compiled with DEFLATE64 (see Z_DEFLATED64
+ * in zlib.h).
  */
 
 #ifdef __cplusplus
@@ -0,0 +1,220 @@
+/* inffast9.c -- fast decoding for inflateBack9()
+ * Copyright (C) 1995-2008, 2010, 2013 Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zutil.h"
+#include "inftree9.h"
+#include "inflate9.h"
+#include "inffast9.h"
+
+#define WSIZE 65536UL
+
+/* Get bytes into the bit accumulator until it has at least n bits */
+#define NEEDBITS(n) \
+    do { \
+        while (bits < (unsigned)(n)) { \
+            hold += (unsigned long)(*in++) << bits; \
+            bits += 8; \
+        } \
+    } while (0)
+
+/* Remove n bits from the bit accumulator */
+#define DROPBITS(n) \
+    do { \
+        hold >>= (n); \
+        bits -= (unsigned)(n); \
+    } while (0)
+
+/*
+   Decode literal, length, and distance codes and write out the resulting
+   literal and match bytes until either not enough input or output is
+   available, an end-of-block is encountered, the next code is the deflate64
+   length code 285, or a data error is encountered.  This is inflate_fast()
+   for inflateBack9(), where the 64K window is also the output buffer: the
+   bytes before strm->next_out are the most recent output, and if the window
+   has wrapped, the bytes from strm->next_out to the end of the window are the
+   output before that.
+
+   Entry assumptions:
+
+        inflateBack9() is in the LEN mode
+        strm->avail_in >= 7
+        strm->avail_out >= 258
+        strm->next_out + strm->avail_out is the end of the window
+        state->bits < 24
+
+   Returns one of:
+
+        LEN -- ran out of enough output space or enough available input, or
+               the next code is length code 285 -- inflateBack9() decodes it
+        TYPE -- reached end of block code, inflateBack9() interprets the next
+                block
+        BAD -- error in block data
+
+   Notes:
+
+    - The maximum input bits used by a length/distance pair, other than for
+      length code 285, is 15 bits for the length code, 5 bits for the length
+      extra, 15 bits for the distance code, and 14 bits for the distance
+      extra.  This totals 49 bits, or seven bytes.  Since only the needed
+      bytes are pulled into the accumulator, if strm->avail_in >= 7, then there
+      is enough input to avoid checking for available input while decoding.
+
+    - Length code 285 has 16 extra bits in deflate64, for lengths up to 65538,
+      which need not fit in the window before it is written out.  It is left
+      to inflateBack9() before any of its bits are used, so the maximum bytes
+      that a single length/distance pair can output here is 258 bytes.
+ */
+inflate_mode inflate_fast9(strm)
+z_stream FAR *strm;
+{
+    struct inflate_state FAR *state;
+    z_const unsigned char FAR *in;      /* local strm->next_in */
+    z_const unsigned char FAR *last;    /* have enough input while in < last */
+    unsigned char FAR *out;     /* local strm->next_out */
+    unsigned char FAR *end;     /* while out < end, enough space available */
+    unsigned char FAR *window;  /* the 64K window and output buffer */
+    int wrap;                   /* true if the window has wrapped */
+    unsigned long hold;         /* local state->hold */
+    unsigned bits;              /* local state->bits */
+    code const FAR *lcode;      /* local state->lencode */
+    code const FAR *dcode;      /* local state->distcode */
+    unsigned lmask;             /* mask for first level of length codes */
+    unsigned dmask;             /* mask for first level of distance codes */
+    code here;                  /* retrieved table entry */
+    unsigned drop;              /* bits to drop for a second level code */
+    unsigned op;                /* operation, extra bits, or output bytes */
+    unsigned len;               /* match length */
+    unsigned dist;              /* match distance */
+    unsigned char FAR *from;    /* where to copy match from */
+    inflate_mode mode;          /* mode to return */
+
+    /* copy state to local variables */
+    state = (struct inflate_state FAR *)strm->state;
+    in = strm->next_in;
+    last = in + (strm->avail_in - 6);
+    out = strm->next_out;
+    end = out + (strm->avail_out - 257);
+    window = state->window;
+    wrap = state->wrap;
+    hold = state->hold;
+    bits = state->bits;
+    lcode = state->lencode;
+    dcode = state->distcode;
+    lmask = (1U << state->lenbits) - 1;
+    dmask = (1U << state->distbits) - 1;
+    mode = LEN;
+
+    /* decode literals and length/distances until end-of-block or not enough
+       input data or output space */
+    do {
+        NEEDBITS(15);
+        here = lcode[hold & lmask];
+        drop = 0;
+        if (here.op && (here.op & 0xf0) == 0) { /* 2nd level length code */
+            drop = here.bits;
+            here = lcode[here.val +
+                         ((unsigned)(hold >> drop) & ((1U << here.op) - 1))];
+        }
+        op = (unsigned)(here.op);
+        if (op == 0) {                          /* literal */
+            DROPBITS(drop + here.bits);
+            Tracevv((stderr, here.val >= 0x20 && here.val < 0x7f ?
+                    "inflate:         literal '%c'\n" :
+                    "inflate:         literal 0x%02x\n", here.val));
+            *out++ = (unsigned char)(here.val);
+        }
+        else if (op & 128) {                    /* length base */
+            if ((op & 31) == 16)                /* leave code 285 */
+                break;
+            DROPBITS(drop + here.bits);
+            len = (unsigned)(here.val);
+            op &= 31;                           /* number of extra bits */
+            if (op) {
+                NEEDBITS(op);
+                len += (unsigned)hold & ((1U << op) - 1);
+                DROPBITS(op);
+            }
+            Tracevv((stderr, "inflate:         length %u\n", len));
+
+            /* get distance code */
+            NEEDBITS(15);
+            here = dcode[hold & dmask];
+            drop = 0;
+            if ((here.op & 0xf0) == 0) {        /* 2nd level distance code */
+                drop = here.bits;
+                here = dcode[here.val +
+                             ((unsigned)(hold >> drop) &
+                              ((1U << here.op) - 1))];
+            }
+            DROPBITS(drop + here.bits);
+            op = (unsigned)(here.op);
+            if (op & 64) {
+                strm->msg = (char *)"invalid distance code";
+                mode = BAD;
+                break;
+            }
+            dist = (unsigned)(here.val);
+            op &= 15;                           /* number of extra bits */
+            if (op) {
+                NEEDBITS(op);
+                dist += (unsigned)hold & ((1U << op) - 1);
+                DROPBITS(op);
+            }
+            Tracevv((stderr, "inflate:         distance %u\n", dist));
+
+            /* copy match, from the end of the window first if needed */
+            op = (unsigned)(out - window);      /* output in this pass */
+            if (dist > op) {
+                if (!wrap) {
+                    strm->msg = (char *)"invalid distance too far back";
+                    mode = BAD;
+                    break;
+                }
+                op = dist - op;                 /* bytes at end of window */
+                from = out + (WSIZE - dist);
+                if (op < len) {
+                    len -= op;
+                    do {
+                        *out++ = *from++;
+                    } while (--op);
+                    from = window;
+                }
+            }
+            else
+                from = out - dist;
+            while (len > 2) {
+                *out++ = *from++;
+                *out++ = *from++;
+                *out++ = *from++;
+                len -= 3;
+            }
+            if (len) {
+                *out++ = *from++;
+                if (len > 1)
+                    *out++ = *from++;
+            }
+        }
+        else if (op & 32) {                     /* end-of-block */
+            DROPBITS(drop + here.bits);
+            Tracevv((stderr, "inflate:         end of block\n"));
+            mode = TYPE;
+            break;
+        }
+        else {
+            strm->msg = (char *)"invalid literal/length code";
+            mode = BAD;
+            break;
+        }
+    } while (in < last && out < end);
+
+    /* update state and return -- unused bits stay in the accumulator */
+    strm->avail_in -= (uInt)(in - strm->next_in);
+    strm->next_in = in;
+    strm->avail_out -= (uInt)(out - strm->next_out);
+    strm->next_out = out;
+    state->hold = hold;
+    state->bits = bits;
+    return mode;
+}
@@ -0,0 +1,11 @@
+/* inffast9.h -- header to use inffast9.c
+ * Copyright (C) 1995-2003, 2010 Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* WARNING: this file should *not* be used by applications. It is
+   part of the implementation of the compression library and is
+   subject to change. Applications should only use zlib.h.
+ */
+
+extern inflate_mode inflate_fast9 OF((z_stream FAR *strm));
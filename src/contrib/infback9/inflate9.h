@@ -35,6 +35,14 @@ typedef enum {
 struct inflate_state {
         /* sliding window */
     unsigned char FAR *window;  /* allocated sliding window, if needed */
+    int wrap;                   /* true if the window has wrapped */
+        /* bit accumulator and tables, passed to inflate_fast9() */
+    unsigned long hold;         /* input bit accumulator */
+    unsigned bits;              /* number of bits in "in" */
+    code const FAR *lencode;    /* starting table for length/literal codes */
+    code const FAR *distcode;   /* starting table for distance codes */
+    unsigned lenbits;           /* index bits for lencode */
+    unsigned distbits;          /* index bits for distcode */
         /* dynamic table building */
     unsigned ncode;             /* number of code length code lengths */
     unsigned nlen;              /* number of length code lengths */
@@ -439,3 +439,451 @@ local const z_crc_t FAR crc_table[TBLS][256] =
 #endif
   }
 };
+
+local const z_crc_t FAR x2n_table[32] = {
+    0x40000000UL, 0x20000000UL, 0x08000000UL, 0x00800000UL, 0x00008000UL,
+    0xedb88320UL, 0xb1e6b092UL, 0xa06a2517UL, 0xed627daeUL, 0x88d14467UL,
+    0xd7bbfe6aUL, 0xec447f11UL, 0x8e7ea170UL, 0x6427800eUL, 0x4d47bae0UL,
+    0x09fe548fUL, 0x83852d0fUL, 0x30362f1aUL, 0x7b5a9cc3UL, 0x31fec169UL,
+    0x9fec022aUL, 0x6c8dedc4UL, 0x15d6874dUL, 0x5fde7a4eUL, 0xbad90e37UL,
+    0x2e4e5eefUL, 0x4eaba214UL, 0xa8a472c0UL, 0x429a969eUL, 0x148d302aUL,
+    0xc40ba6d0UL, 0xc4e22c3cUL
+};
+
+#ifdef BRAID
+local const z_crc_t FAR crc_braid_table[W][256] =
+{
+  {
+    0x00000000UL, 0xaf449247UL, 0x85f822cfUL, 0x2abcb088UL, 0xd08143dfUL,
+    0x7fc5d198UL, 0x55796110UL, 0xfa3df357UL, 0x7a7381ffUL, 0xd53713b8UL,
+    0xff8ba330UL, 0x50cf3177UL, 0xaaf2c220UL, 0x05b65067UL, 0x2f0ae0efUL,
+    0x804e72a8UL, 0xf4e703feUL, 0x5ba391b9UL, 0x711f2131UL, 0xde5bb376UL,
+    0x24664021UL, 0x8b22d266UL, 0xa19e62eeUL, 0x0edaf0a9UL, 0x8e948201UL,
+    0x21d01046UL, 0x0b6ca0ceUL, 0xa4283289UL, 0x5e15c1deUL, 0xf1515399UL,
+    0xdbede311UL, 0x74a97156UL, 0x32bf01bdUL, 0x9dfb93faUL, 0xb7472372UL,
+    0x1803b135UL, 0xe23e4262UL, 0x4d7ad025UL, 0x67c660adUL, 0xc882f2eaUL,
+    0x48cc8042UL, 0xe7881205UL, 0xcd34a28dUL, 0x627030caUL, 0x984dc39dUL,
+    0x370951daUL, 0x1db5e152UL, 0xb2f17315UL, 0xc6580243UL, 0x691c9004UL,
+    0x43a0208cUL, 0xece4b2cbUL, 0x16d9419cUL, 0xb99dd3dbUL, 0x93216353UL,
+    0x3c65f114UL, 0xbc2b83bcUL, 0x136f11fbUL, 0x39d3a173UL, 0x96973334UL,
+    0x6caac063UL, 0xc3ee5224UL, 0xe952e2acUL, 0x461670ebUL, 0x657e037aUL,
+    0xca3a913dUL, 0xe08621b5UL, 0x4fc2b3f2UL, 0xb5ff40a5UL, 0x1abbd2e2UL,
+    0x3007626aUL, 0x9f43f02dUL, 0x1f0d8285UL, 0xb04910c2UL, 0x9af5a04aUL,
+    0x35b1320dUL, 0xcf8cc15aUL, 0x60c8531dUL, 0x4a74e395UL, 0xe53071d2UL,
+    0x91990084UL, 0x3edd92c3UL, 0x1461224bUL, 0xbb25b00cUL, 0x4118435bUL,
+    0xee5cd11cUL, 0xc4e06194UL, 0x6ba4f3d3UL, 0xebea817bUL, 0x44ae133cUL,
+    0x6e12a3b4UL, 0xc15631f3UL, 0x3b6bc2a4UL, 0x942f50e3UL, 0xbe93e06bUL,
+    0x11d7722cUL, 0x57c102c7UL, 0xf8859080UL, 0xd2392008UL, 0x7d7db24fUL,
+    0x87404118UL, 0x2804d35fUL, 0x02b863d7UL, 0xadfcf190UL, 0x2db28338UL,
+    0x82f6117fUL, 0xa84aa1f7UL, 0x070e33b0UL, 0xfd33c0e7UL, 0x527752a0UL,
+    0x78cbe228UL, 0xd78f706fUL, 0xa3260139UL, 0x0c62937eUL, 0x26de23f6UL,
+    0x899ab1b1UL, 0x73a742e6UL, 0xdce3d0a1UL, 0xf65f6029UL, 0x591bf26eUL,
+    0xd95580c6UL, 0x76111281UL, 0x5cada209UL, 0xf3e9304eUL, 0x09d4c319UL,
+    0xa690515eUL, 0x8c2ce1d6UL, 0x23687391UL, 0xcafc06f4UL, 0x65b894b3UL,
+    0x4f04243bUL, 0xe040b67cUL, 0x1a7d452bUL, 0xb539d76cUL, 0x9f8567e4UL,
+    0x30c1f5a3UL, 0xb08f870bUL, 0x1fcb154cUL, 0x3577a5c4UL, 0x9a333783UL,
+    0x600ec4d4UL, 0xcf4a5693UL, 0xe5f6e61bUL, 0x4ab2745cUL, 0x3e1b050aUL,
+    0x915f974dUL, 0xbbe327c5UL, 0x14a7b582UL, 0xee9a46d5UL, 0x41ded492UL,
+    0x6b62641aUL, 0xc426f65dUL, 0x446884f5UL, 0xeb2c16b2UL, 0xc190a63aUL,
+    0x6ed4347dUL, 0x94e9c72aUL, 0x3bad556dUL, 0x1111e5e5UL, 0xbe5577a2UL,
+    0xf8430749UL, 0x5707950eUL, 0x7dbb2586UL, 0xd2ffb7c1UL, 0x28c24496UL,
+    0x8786d6d1UL, 0xad3a6659UL, 0x027ef41eUL, 0x823086b6UL, 0x2d7414f1UL,
+    0x07c8a479UL, 0xa88c363eUL, 0x52b1c569UL, 0xfdf5572eUL, 0xd749e7a6UL,
+    0x780d75e1UL, 0x0ca404b7UL, 0xa3e096f0UL, 0x895c2678UL, 0x2618b43fUL,
+    0xdc254768UL, 0x7361d52fUL, 0x59dd65a7UL, 0xf699f7e0UL, 0x76d78548UL,
+    0xd993170fUL, 0xf32fa787UL, 0x5c6b35c0UL, 0xa656c697UL, 0x091254d0UL,
+    0x23aee458UL, 0x8cea761fUL, 0xaf82058eUL, 0x00c697c9UL, 0x2a7a2741UL,
+    0x853eb506UL, 0x7f034651UL, 0xd047d416UL, 0xfafb649eUL, 0x55bff6d9UL,
+    0xd5f18471UL, 0x7ab51636UL, 0x5009a6beUL, 0xff4d34f9UL, 0x0570c7aeUL,
+    0xaa3455e9UL, 0x8088e561UL, 0x2fcc7726UL, 0x5b650670UL, 0xf4219437UL,
+    0xde9d24bfUL, 0x71d9b6f8UL, 0x8be445afUL, 0x24a0d7e8UL, 0x0e1c6760UL,
+    0xa158f527UL, 0x2116878fUL, 0x8e5215c8UL, 0xa4eea540UL, 0x0baa3707UL,
+    0xf197c450UL, 0x5ed35617UL, 0x746fe69fUL, 0xdb2b74d8UL, 0x9d3d0433UL,
+    0x32799674UL, 0x18c526fcUL, 0xb781b4bbUL, 0x4dbc47ecUL, 0xe2f8d5abUL,
+    0xc8446523UL, 0x6700f764UL, 0xe74e85ccUL, 0x480a178bUL, 0x62b6a703UL,
+    0xcdf23544UL, 0x37cfc613UL, 0x988b5454UL, 0xb237e4dcUL, 0x1d73769bUL,
+    0x69da07cdUL, 0xc69e958aUL, 0xec222502UL, 0x4366b745UL, 0xb95b4412UL,
+    0x161fd655UL, 0x3ca366ddUL, 0x93e7f49aUL, 0x13a98632UL, 0xbced1475UL,
+    0x9651a4fdUL, 0x391536baUL, 0xc328c5edUL, 0x6c6c57aaUL, 0x46d0e722UL,
+    0xe9947565UL
+  },
+  {
+    0x00000000UL, 0x4e890ba9UL, 0x9d121752UL, 0xd39b1cfbUL, 0xe15528e5UL,
+    0xafdc234cUL, 0x7c473fb7UL, 0x32ce341eUL, 0x19db578bUL, 0x57525c22UL,
+    0x84c940d9UL, 0xca404b70UL, 0xf88e7f6eUL, 0xb60774c7UL, 0x659c683cUL,
+    0x2b156395UL, 0x33b6af16UL, 0x7d3fa4bfUL, 0xaea4b844UL, 0xe02db3edUL,
+    0xd2e387f3UL, 0x9c6a8c5aUL, 0x4ff190a1UL, 0x01789b08UL, 0x2a6df89dUL,
+    0x64e4f334UL, 0xb77fefcfUL, 0xf9f6e466UL, 0xcb38d078UL, 0x85b1dbd1UL,
+    0x562ac72aUL, 0x18a3cc83UL, 0x676d5e2cUL, 0x29e45585UL, 0xfa7f497eUL,
+    0xb4f642d7UL, 0x863876c9UL, 0xc8b17d60UL, 0x1b2a619bUL, 0x55a36a32UL,
+    0x7eb609a7UL, 0x303f020eUL, 0xe3a41ef5UL, 0xad2d155cUL, 0x9fe32142UL,
+    0xd16a2aebUL, 0x02f13610UL, 0x4c783db9UL, 0x54dbf13aUL, 0x1a52fa93UL,
+    0xc9c9e668UL, 0x8740edc1UL, 0xb58ed9dfUL, 0xfb07d276UL, 0x289cce8dUL,
+    0x6615c524UL, 0x4d00a6b1UL, 0x0389ad18UL, 0xd012b1e3UL, 0x9e9bba4aUL,
+    0xac558e54UL, 0xe2dc85fdUL, 0x31479906UL, 0x7fce92afUL, 0xcedabc58UL,
+    0x8053b7f1UL, 0x53c8ab0aUL, 0x1d41a0a3UL, 0x2f8f94bdUL, 0x61069f14UL,
+    0xb29d83efUL, 0xfc148846UL, 0xd701ebd3UL, 0x9988e07aUL, 0x4a13fc81UL,
+    0x049af728UL, 0x3654c336UL, 0x78ddc89fUL, 0xab46d464UL, 0xe5cfdfcdUL,
+    0xfd6c134eUL, 0xb3e518e7UL, 0x607e041cUL, 0x2ef70fb5UL, 0x1c393babUL,
+    0x52b03002UL, 0x812b2cf9UL, 0xcfa22750UL, 0xe4b744c5UL, 0xaa3e4f6cUL,
+    0x79a55397UL, 0x372c583eUL, 0x05e26c20UL, 0x4b6b6789UL, 0x98f07b72UL,
+    0xd67970dbUL, 0xa9b7e274UL, 0xe73ee9ddUL, 0x34a5f526UL, 0x7a2cfe8fUL,
+    0x48e2ca91UL, 0x066bc138UL, 0xd5f0ddc3UL, 0x9b79d66aUL, 0xb06cb5ffUL,
+    0xfee5be56UL, 0x2d7ea2adUL, 0x63f7a904UL, 0x51399d1aUL, 0x1fb096b3UL,
+    0xcc2b8a48UL, 0x82a281e1UL, 0x9a014d62UL, 0xd48846cbUL, 0x07135a30UL,
+    0x499a5199UL, 0x7b546587UL, 0x35dd6e2eUL, 0xe64672d5UL, 0xa8cf797cUL,
+    0x83da1ae9UL, 0xcd531140UL, 0x1ec80dbbUL, 0x50410612UL, 0x628f320cUL,
+    0x2c0639a5UL, 0xff9d255eUL, 0xb1142ef7UL, 0x46c47ef1UL, 0x084d7558UL,
+    0xdbd669a3UL, 0x955f620aUL, 0xa7915614UL, 0xe9185dbdUL, 0x3a834146UL,
+    0x740a4aefUL, 0x5f1f297aUL, 0x119622d3UL, 0xc20d3e28UL, 0x8c843581UL,
+    0xbe4a019fUL, 0xf0c30a36UL, 0x235816cdUL, 0x6dd11d64UL, 0x7572d1e7UL,
+    0x3bfbda4eUL, 0xe860c6b5UL, 0xa6e9cd1cUL, 0x9427f902UL, 0xdaaef2abUL,
+    0x0935ee50UL, 0x47bce5f9UL, 0x6ca9866cUL, 0x22208dc5UL, 0xf1bb913eUL,
+    0xbf329a97UL, 0x8dfcae89UL, 0xc375a520UL, 0x10eeb9dbUL, 0x5e67b272UL,
+    0x21a920ddUL, 0x6f202b74UL, 0xbcbb378fUL, 0xf2323c26UL, 0xc0fc0838UL,
+    0x8e750391UL, 0x5dee1f6aUL, 0x136714c3UL, 0x38727756UL, 0x76fb7cffUL,
+    0xa5606004UL, 0xebe96badUL, 0xd9275fb3UL, 0x97ae541aUL, 0x443548e1UL,
+    0x0abc4348UL, 0x121f8fcbUL, 0x5c968462UL, 0x8f0d9899UL, 0xc1849330UL,
+    0xf34aa72eUL, 0xbdc3ac87UL, 0x6e58b07cUL, 0x20d1bbd5UL, 0x0bc4d840UL,
+    0x454dd3e9UL, 0x96d6cf12UL, 0xd85fc4bbUL, 0xea91f0a5UL, 0xa418fb0cUL,
+    0x7783e7f7UL, 0x390aec5eUL, 0x881ec2a9UL, 0xc697c900UL, 0x150cd5fbUL,
+    0x5b85de52UL, 0x694bea4cUL, 0x27c2e1e5UL, 0xf459fd1eUL, 0xbad0f6b7UL,
+    0x91c59522UL, 0xdf4c9e8bUL, 0x0cd78270UL, 0x425e89d9UL, 0x7090bdc7UL,
+    0x3e19b66eUL, 0xed82aa95UL, 0xa30ba13cUL, 0xbba86dbfUL, 0xf5216616UL,
+    0x26ba7aedUL, 0x68337144UL, 0x5afd455aUL, 0x14744ef3UL, 0xc7ef5208UL,
+    0x896659a1UL, 0xa2733a34UL, 0xecfa319dUL, 0x3f612d66UL, 0x71e826cfUL,
+    0x432612d1UL, 0x0daf1978UL, 0xde340583UL, 0x90bd0e2aUL, 0xef739c85UL,
+    0xa1fa972cUL, 0x72618bd7UL, 0x3ce8807eUL, 0x0e26b460UL, 0x40afbfc9UL,
+    0x9334a332UL, 0xddbda89bUL, 0xf6a8cb0eUL, 0xb821c0a7UL, 0x6bbadc5cUL,
+    0x2533d7f5UL, 0x17fde3ebUL, 0x5974e842UL, 0x8aeff4b9UL, 0xc466ff10UL,
+    0xdcc53393UL, 0x924c383aUL, 0x41d724c1UL, 0x0f5e2f68UL, 0x3d901b76UL,
+    0x731910dfUL, 0xa0820c24UL, 0xee0b078dUL, 0xc51e6418UL, 0x8b976fb1UL,
+    0x580c734aUL, 0x168578e3UL, 0x244b4cfdUL, 0x6ac24754UL, 0xb9595bafUL,
+    0xf7d05006UL
+  },
+  {
+    0x00000000UL, 0x8d88fde2UL, 0xc060fd85UL, 0x4de80067UL, 0x5bb0fd4bUL,
+    0xd63800a9UL, 0x9bd000ceUL, 0x1658fd2cUL, 0xb761fa96UL, 0x3ae90774UL,
+    0x77010713UL, 0xfa89faf1UL, 0xecd107ddUL, 0x6159fa3fUL, 0x2cb1fa58UL,
+    0xa13907baUL, 0xb5b2f36dUL, 0x383a0e8fUL, 0x75d20ee8UL, 0xf85af30aUL,
+    0xee020e26UL, 0x638af3c4UL, 0x2e62f3a3UL, 0xa3ea0e41UL, 0x02d309fbUL,
+    0x8f5bf419UL, 0xc2b3f47eUL, 0x4f3b099cUL, 0x5963f4b0UL, 0xd4eb0952UL,
+    0x99030935UL, 0x148bf4d7UL, 0xb014e09bUL, 0x3d9c1d79UL, 0x70741d1eUL,
+    0xfdfce0fcUL, 0xeba41dd0UL, 0x662ce032UL, 0x2bc4e055UL, 0xa64c1db7UL,
+    0x07751a0dUL, 0x8afde7efUL, 0xc715e788UL, 0x4a9d1a6aUL, 0x5cc5e746UL,
+    0xd14d1aa4UL, 0x9ca51ac3UL, 0x112de721UL, 0x05a613f6UL, 0x882eee14UL,
+    0xc5c6ee73UL, 0x484e1391UL, 0x5e16eebdUL, 0xd39e135fUL, 0x9e761338UL,
+    0x13feeedaUL, 0xb2c7e960UL, 0x3f4f1482UL, 0x72a714e5UL, 0xff2fe907UL,
+    0xe977142bUL, 0x64ffe9c9UL, 0x2917e9aeUL, 0xa49f144cUL, 0xbb58c777UL,
+    0x36d03a95UL, 0x7b383af2UL, 0xf6b0c710UL, 0xe0e83a3cUL, 0x6d60c7deUL,
+    0x2088c7b9UL, 0xad003a5bUL, 0x0c393de1UL, 0x81b1c003UL, 0xcc59c064UL,
+    0x41d13d86UL, 0x5789c0aaUL, 0xda013d48UL, 0x97e93d2fUL, 0x1a61c0cdUL,
+    0x0eea341aUL, 0x8362c9f8UL, 0xce8ac99fUL, 0x4302347dUL, 0x555ac951UL,
+    0xd8d234b3UL, 0x953a34d4UL, 0x18b2c936UL, 0xb98bce8cUL, 0x3403336eUL,
+    0x79eb3309UL, 0xf463ceebUL, 0xe23b33c7UL, 0x6fb3ce25UL, 0x225bce42UL,
+    0xafd333a0UL, 0x0b4c27ecUL, 0x86c4da0eUL, 0xcb2cda69UL, 0x46a4278bUL,
+    0x50fcdaa7UL, 0xdd742745UL, 0x909c2722UL, 0x1d14dac0UL, 0xbc2ddd7aUL,
+    0x31a52098UL, 0x7c4d20ffUL, 0xf1c5dd1dUL, 0xe79d2031UL, 0x6a15ddd3UL,
+    0x27fdddb4UL, 0xaa752056UL, 0xbefed481UL, 0x33762963UL, 0x7e9e2904UL,
+    0xf316d4e6UL, 0xe54e29caUL, 0x68c6d428UL, 0x252ed44fUL, 0xa8a629adUL,
+    0x099f2e17UL, 0x8417d3f5UL, 0xc9ffd392UL, 0x44772e70UL, 0x522fd35cUL,
+    0xdfa72ebeUL, 0x924f2ed9UL, 0x1fc7d33bUL, 0xadc088afUL, 0x2048754dUL,
+    0x6da0752aUL, 0xe02888c8UL, 0xf67075e4UL, 0x7bf88806UL, 0x36108861UL,
+    0xbb987583UL, 0x1aa17239UL, 0x97298fdbUL, 0xdac18fbcUL, 0x5749725eUL,
+    0x41118f72UL, 0xcc997290UL, 0x817172f7UL, 0x0cf98f15UL, 0x18727bc2UL,
+    0x95fa8620UL, 0xd8128647UL, 0x559a7ba5UL, 0x43c28689UL, 0xce4a7b6bUL,
+    0x83a27b0cUL, 0x0e2a86eeUL, 0xaf138154UL, 0x229b7cb6UL, 0x6f737cd1UL,
+    0xe2fb8133UL, 0xf4a37c1fUL, 0x792b81fdUL, 0x34c3819aUL, 0xb94b7c78UL,
+    0x1dd46834UL, 0x905c95d6UL, 0xddb495b1UL, 0x503c6853UL, 0x4664957fUL,
+    0xcbec689dUL, 0x860468faUL, 0x0b8c9518UL, 0xaab592a2UL, 0x273d6f40UL,
+    0x6ad56f27UL, 0xe75d92c5UL, 0xf1056fe9UL, 0x7c8d920bUL, 0x3165926cUL,
+    0xbced6f8eUL, 0xa8669b59UL, 0x25ee66bbUL, 0x680666dcUL, 0xe58e9b3eUL,
+    0xf3d66612UL, 0x7e5e9bf0UL, 0x33b69b97UL, 0xbe3e6675UL, 0x1f0761cfUL,
+    0x928f9c2dUL, 0xdf679c4aUL, 0x52ef61a8UL, 0x44b79c84UL, 0xc93f6166UL,
+    0x84d76101UL, 0x095f9ce3UL, 0x16984fd8UL, 0x9b10b23aUL, 0xd6f8b25dUL,
+    0x5b704fbfUL, 0x4d28b293UL, 0xc0a04f71UL, 0x8d484f16UL, 0x00c0b2f4UL,
+    0xa1f9b54eUL, 0x2c7148acUL, 0x619948cbUL, 0xec11b529UL, 0xfa494805UL,
+    0x77c1b5e7UL, 0x3a29b580UL, 0xb7a14862UL, 0xa32abcb5UL, 0x2ea24157UL,
+    0x634a4130UL, 0xeec2bcd2UL, 0xf89a41feUL, 0x7512bc1cUL, 0x38fabc7bUL,
+    0xb5724199UL, 0x144b4623UL, 0x99c3bbc1UL, 0xd42bbba6UL, 0x59a34644UL,
+    0x4ffbbb68UL, 0xc273468aUL, 0x8f9b46edUL, 0x0213bb0fUL, 0xa68caf43UL,
+    0x2b0452a1UL, 0x66ec52c6UL, 0xeb64af24UL, 0xfd3c5208UL, 0x70b4afeaUL,
+    0x3d5caf8dUL, 0xb0d4526fUL, 0x11ed55d5UL, 0x9c65a837UL, 0xd18da850UL,
+    0x5c0555b2UL, 0x4a5da89eUL, 0xc7d5557cUL, 0x8a3d551bUL, 0x07b5a8f9UL,
+    0x133e5c2eUL, 0x9eb6a1ccUL, 0xd35ea1abUL, 0x5ed65c49UL, 0x488ea165UL,
+    0xc5065c87UL, 0x88ee5ce0UL, 0x0566a102UL, 0xa45fa6b8UL, 0x29d75b5aUL,
+    0x643f5b3dUL, 0xe9b7a6dfUL, 0xffef5bf3UL, 0x7267a611UL, 0x3f8fa676UL,
+    0xb2075b94UL
+  },
+  {
+    0x00000000UL, 0x80f0171fUL, 0xda91287fUL, 0x5a613f60UL, 0x6e5356bfUL,
+    0xeea341a0UL, 0xb4c27ec0UL, 0x343269dfUL, 0xdca6ad7eUL, 0x5c56ba61UL,
+    0x06378501UL, 0x86c7921eUL, 0xb2f5fbc1UL, 0x3205ecdeUL, 0x6864d3beUL,
+    0xe894c4a1UL, 0x623c5cbdUL, 0xe2cc4ba2UL, 0xb8ad74c2UL, 0x385d63ddUL,
+    0x0c6f0a02UL, 0x8c9f1d1dUL, 0xd6fe227dUL, 0x560e3562UL, 0xbe9af1c3UL,
+    0x3e6ae6dcUL, 0x640bd9bcUL, 0xe4fbcea3UL, 0xd0c9a77cUL, 0x5039b063UL,
+    0x0a588f03UL, 0x8aa8981cUL, 0xc478b97aUL, 0x4488ae65UL, 0x1ee99105UL,
+    0x9e19861aUL, 0xaa2befc5UL, 0x2adbf8daUL, 0x70bac7baUL, 0xf04ad0a5UL,
+    0x18de1404UL, 0x982e031bUL, 0xc24f3c7bUL, 0x42bf2b64UL, 0x768d42bbUL,
+    0xf67d55a4UL, 0xac1c6ac4UL, 0x2cec7ddbUL, 0xa644e5c7UL, 0x26b4f2d8UL,
+    0x7cd5cdb8UL, 0xfc25daa7UL, 0xc817b378UL, 0x48e7a467UL, 0x12869b07UL,
+    0x92768c18UL, 0x7ae248b9UL, 0xfa125fa6UL, 0xa07360c6UL, 0x208377d9UL,
+    0x14b11e06UL, 0x94410919UL, 0xce203679UL, 0x4ed02166UL, 0x538074b5UL,
+    0xd37063aaUL, 0x89115ccaUL, 0x09e14bd5UL, 0x3dd3220aUL, 0xbd233515UL,
+    0xe7420a75UL, 0x67b21d6aUL, 0x8f26d9cbUL, 0x0fd6ced4UL, 0x55b7f1b4UL,
+    0xd547e6abUL, 0xe1758f74UL, 0x6185986bUL, 0x3be4a70bUL, 0xbb14b014UL,
+    0x31bc2808UL, 0xb14c3f17UL, 0xeb2d0077UL, 0x6bdd1768UL, 0x5fef7eb7UL,
+    0xdf1f69a8UL, 0x857e56c8UL, 0x058e41d7UL, 0xed1a8576UL, 0x6dea9269UL,
+    0x378bad09UL, 0xb77bba16UL, 0x8349d3c9UL, 0x03b9c4d6UL, 0x59d8fbb6UL,
+    0xd928eca9UL, 0x97f8cdcfUL, 0x1708dad0UL, 0x4d69e5b0UL, 0xcd99f2afUL,
+    0xf9ab9b70UL, 0x795b8c6fUL, 0x233ab30fUL, 0xa3caa410UL, 0x4b5e60b1UL,
+    0xcbae77aeUL, 0x91cf48ceUL, 0x113f5fd1UL, 0x250d360eUL, 0xa5fd2111UL,
+    0xff9c1e71UL, 0x7f6c096eUL, 0xf5c49172UL, 0x7534866dUL, 0x2f55b90dUL,
+    0xafa5ae12UL, 0x9b97c7cdUL, 0x1b67d0d2UL, 0x4106efb2UL, 0xc1f6f8adUL,
+    0x29623c0cUL, 0xa9922b13UL, 0xf3f31473UL, 0x7303036cUL, 0x47316ab3UL,
+    0xc7c17dacUL, 0x9da042ccUL, 0x1d5055d3UL, 0xa700e96aUL, 0x27f0fe75UL,
+    0x7d91c115UL, 0xfd61d60aUL, 0xc953bfd5UL, 0x49a3a8caUL, 0x13c297aaUL,
+    0x933280b5UL, 0x7ba64414UL, 0xfb56530bUL, 0xa1376c6bUL, 0x21c77b74UL,
+    0x15f512abUL, 0x950505b4UL, 0xcf643ad4UL, 0x4f942dcbUL, 0xc53cb5d7UL,
+    0x45cca2c8UL, 0x1fad9da8UL, 0x9f5d8ab7UL, 0xab6fe368UL, 0x2b9ff477UL,
+    0x71fecb17UL, 0xf10edc08UL, 0x199a18a9UL, 0x996a0fb6UL, 0xc30b30d6UL,
+    0x43fb27c9UL, 0x77c94e16UL, 0xf7395909UL, 0xad586669UL, 0x2da87176UL,
+    0x63785010UL, 0xe388470fUL, 0xb9e9786fUL, 0x39196f70UL, 0x0d2b06afUL,
+    0x8ddb11b0UL, 0xd7ba2ed0UL, 0x574a39cfUL, 0xbfdefd6eUL, 0x3f2eea71UL,
+    0x654fd511UL, 0xe5bfc20eUL, 0xd18dabd1UL, 0x517dbcceUL, 0x0b1c83aeUL,
+    0x8bec94b1UL, 0x01440cadUL, 0x81b41bb2UL, 0xdbd524d2UL, 0x5b2533cdUL,
+    0x6f175a12UL, 0xefe74d0dUL, 0xb586726dUL, 0x35766572UL, 0xdde2a1d3UL,
+    0x5d12b6ccUL, 0x077389acUL, 0x87839eb3UL, 0xb3b1f76cUL, 0x3341e073UL,
+    0x6920df13UL, 0xe9d0c80cUL, 0xf4809ddfUL, 0x74708ac0UL, 0x2e11b5a0UL,
+    0xaee1a2bfUL, 0x9ad3cb60UL, 0x1a23dc7fUL, 0x4042e31fUL, 0xc0b2f400UL,
+    0x282630a1UL, 0xa8d627beUL, 0xf2b718deUL, 0x72470fc1UL, 0x4675661eUL,
+    0xc6857101UL, 0x9ce44e61UL, 0x1c14597eUL, 0x96bcc162UL, 0x164cd67dUL,
+    0x4c2de91dUL, 0xccddfe02UL, 0xf8ef97ddUL, 0x781f80c2UL, 0x227ebfa2UL,
+    0xa28ea8bdUL, 0x4a1a6c1cUL, 0xcaea7b03UL, 0x908b4463UL, 0x107b537cUL,
+    0x24493aa3UL, 0xa4b92dbcUL, 0xfed812dcUL, 0x7e2805c3UL, 0x30f824a5UL,
+    0xb00833baUL, 0xea690cdaUL, 0x6a991bc5UL, 0x5eab721aUL, 0xde5b6505UL,
+    0x843a5a65UL, 0x04ca4d7aUL, 0xec5e89dbUL, 0x6cae9ec4UL, 0x36cfa1a4UL,
+    0xb63fb6bbUL, 0x820ddf64UL, 0x02fdc87bUL, 0x589cf71bUL, 0xd86ce004UL,
+    0x52c47818UL, 0xd2346f07UL, 0x88555067UL, 0x08a54778UL, 0x3c972ea7UL,
+    0xbc6739b8UL, 0xe60606d8UL, 0x66f611c7UL, 0x8e62d566UL, 0x0e92c279UL,
+    0x54f3fd19UL, 0xd403ea06UL, 0xe03183d9UL, 0x60c194c6UL, 0x3aa0aba6UL,
+    0xba50bcb9UL
+  },
+  {
+    0x00000000UL, 0x9570d495UL, 0xf190af6bUL, 0x64e07bfeUL, 0x38505897UL,
+    0xad208c02UL, 0xc9c0f7fcUL, 0x5cb02369UL, 0x70a0b12eUL, 0xe5d065bbUL,
+    0x81301e45UL, 0x1440cad0UL, 0x48f0e9b9UL, 0xdd803d2cUL, 0xb96046d2UL,
+    0x2c109247UL, 0xe141625cUL, 0x7431b6c9UL, 0x10d1cd37UL, 0x85a119a2UL,
+    0xd9113acbUL, 0x4c61ee5eUL, 0x288195a0UL, 0xbdf14135UL, 0x91e1d372UL,
+    0x049107e7UL, 0x60717c19UL, 0xf501a88cUL, 0xa9b18be5UL, 0x3cc15f70UL,
+    0x5821248eUL, 0xcd51f01bUL, 0x19f3c2f9UL, 0x8c83166cUL, 0xe8636d92UL,
+    0x7d13b907UL, 0x21a39a6eUL, 0xb4d34efbUL, 0xd0333505UL, 0x4543e190UL,
+    0x695373d7UL, 0xfc23a742UL, 0x98c3dcbcUL, 0x0db30829UL, 0x51032b40UL,
+    0xc473ffd5UL, 0xa093842bUL, 0x35e350beUL, 0xf8b2a0a5UL, 0x6dc27430UL,
+    0x09220fceUL, 0x9c52db5bUL, 0xc0e2f832UL, 0x55922ca7UL, 0x31725759UL,
+    0xa40283ccUL, 0x8812118bUL, 0x1d62c51eUL, 0x7982bee0UL, 0xecf26a75UL,
+    0xb042491cUL, 0x25329d89UL, 0x41d2e677UL, 0xd4a232e2UL, 0x33e785f2UL,
+    0xa6975167UL, 0xc2772a99UL, 0x5707fe0cUL, 0x0bb7dd65UL, 0x9ec709f0UL,
+    0xfa27720eUL, 0x6f57a69bUL, 0x434734dcUL, 0xd637e049UL, 0xb2d79bb7UL,
+    0x27a74f22UL, 0x7b176c4bUL, 0xee67b8deUL, 0x8a87c320UL, 0x1ff717b5UL,
+    0xd2a6e7aeUL, 0x47d6333bUL, 0x233648c5UL, 0xb6469c50UL, 0xeaf6bf39UL,
+    0x7f866bacUL, 0x1b661052UL, 0x8e16c4c7UL, 0xa2065680UL, 0x37768215UL,
+    0x5396f9ebUL, 0xc6e62d7eUL, 0x9a560e17UL, 0x0f26da82UL, 0x6bc6a17cUL,
+    0xfeb675e9UL, 0x2a14470bUL, 0xbf64939eUL, 0xdb84e860UL, 0x4ef43cf5UL,
+    0x12441f9cUL, 0x8734cb09UL, 0xe3d4b0f7UL, 0x76a46462UL, 0x5ab4f625UL,
+    0xcfc422b0UL, 0xab24594eUL, 0x3e548ddbUL, 0x62e4aeb2UL, 0xf7947a27UL,
+    0x937401d9UL, 0x0604d54cUL, 0xcb552557UL, 0x5e25f1c2UL, 0x3ac58a3cUL,
+    0xafb55ea9UL, 0xf3057dc0UL, 0x6675a955UL, 0x0295d2abUL, 0x97e5063eUL,
+    0xbbf59479UL, 0x2e8540ecUL, 0x4a653b12UL, 0xdf15ef87UL, 0x83a5cceeUL,
+    0x16d5187bUL, 0x72356385UL, 0xe745b710UL, 0x67cf0be4UL, 0xf2bfdf71UL,
+    0x965fa48fUL, 0x032f701aUL, 0x5f9f5373UL, 0xcaef87e6UL, 0xae0ffc18UL,
+    0x3b7f288dUL, 0x176fbacaUL, 0x821f6e5fUL, 0xe6ff15a1UL, 0x738fc134UL,
+    0x2f3fe25dUL, 0xba4f36c8UL, 0xdeaf4d36UL, 0x4bdf99a3UL, 0x868e69b8UL,
+    0x13febd2dUL, 0x771ec6d3UL, 0xe26e1246UL, 0xbede312fUL, 0x2baee5baUL,
+    0x4f4e9e44UL, 0xda3e4ad1UL, 0xf62ed896UL, 0x635e0c03UL, 0x07be77fdUL,
+    0x92cea368UL, 0xce7e8001UL, 0x5b0e5494UL, 0x3fee2f6aUL, 0xaa9efbffUL,
+    0x7e3cc91dUL, 0xeb4c1d88UL, 0x8fac6676UL, 0x1adcb2e3UL, 0x466c918aUL,
+    0xd31c451fUL, 0xb7fc3ee1UL, 0x228cea74UL, 0x0e9c7833UL, 0x9becaca6UL,
+    0xff0cd758UL, 0x6a7c03cdUL, 0x36cc20a4UL, 0xa3bcf431UL, 0xc75c8fcfUL,
+    0x522c5b5aUL, 0x9f7dab41UL, 0x0a0d7fd4UL, 0x6eed042aUL, 0xfb9dd0bfUL,
+    0xa72df3d6UL, 0x325d2743UL, 0x56bd5cbdUL, 0xc3cd8828UL, 0xefdd1a6fUL,
+    0x7aadcefaUL, 0x1e4db504UL, 0x8b3d6191UL, 0xd78d42f8UL, 0x42fd966dUL,
+    0x261ded93UL, 0xb36d3906UL, 0x54288e16UL, 0xc1585a83UL, 0xa5b8217dUL,
+    0x30c8f5e8UL, 0x6c78d681UL, 0xf9080214UL, 0x9de879eaUL, 0x0898ad7fUL,
+    0x24883f38UL, 0xb1f8ebadUL, 0xd5189053UL, 0x406844c6UL, 0x1cd867afUL,
+    0x89a8b33aUL, 0xed48c8c4UL, 0x78381c51UL, 0xb569ec4aUL, 0x201938dfUL,
+    0x44f94321UL, 0xd18997b4UL, 0x8d39b4ddUL, 0x18496048UL, 0x7ca91bb6UL,
+    0xe9d9cf23UL, 0xc5c95d64UL, 0x50b989f1UL, 0x3459f20fUL, 0xa129269aUL,
+    0xfd9905f3UL, 0x68e9d166UL, 0x0c09aa98UL, 0x99797e0dUL, 0x4ddb4cefUL,
+    0xd8ab987aUL, 0xbc4be384UL, 0x293b3711UL, 0x758b1478UL, 0xe0fbc0edUL,
+    0x841bbb13UL, 0x116b6f86UL, 0x3d7bfdc1UL, 0xa80b2954UL, 0xcceb52aaUL,
+    0x599b863fUL, 0x052ba556UL, 0x905b71c3UL, 0xf4bb0a3dUL, 0x61cbdea8UL,
+    0xac9a2eb3UL, 0x39eafa26UL, 0x5d0a81d8UL, 0xc87a554dUL, 0x94ca7624UL,
+    0x01baa2b1UL, 0x655ad94fUL, 0xf02a0ddaUL, 0xdc3a9f9dUL, 0x494a4b08UL,
+    0x2daa30f6UL, 0xb8dae463UL, 0xe46ac70aUL, 0x711a139fUL, 0x15fa6861UL,
+    0x808abcf4UL
+  },
+  {
+    0x00000000UL, 0xcf9e17c8UL, 0x444d29d1UL, 0x8bd33e19UL, 0x889a53a2UL,
+    0x4704446aUL, 0xccd77a73UL, 0x03496dbbUL, 0xca45a105UL, 0x05dbb6cdUL,
+    0x8e0888d4UL, 0x41969f1cUL, 0x42dff2a7UL, 0x8d41e56fUL, 0x0692db76UL,
+    0xc90cccbeUL, 0x4ffa444bUL, 0x80645383UL, 0x0bb76d9aUL, 0xc4297a52UL,
+    0xc76017e9UL, 0x08fe0021UL, 0x832d3e38UL, 0x4cb329f0UL, 0x85bfe54eUL,
+    0x4a21f286UL, 0xc1f2cc9fUL, 0x0e6cdb57UL, 0x0d25b6ecUL, 0xc2bba124UL,
+    0x49689f3dUL, 0x86f688f5UL, 0x9ff48896UL, 0x506a9f5eUL, 0xdbb9a147UL,
+    0x1427b68fUL, 0x176edb34UL, 0xd8f0ccfcUL, 0x5323f2e5UL, 0x9cbde52dUL,
+    0x55b12993UL, 0x9a2f3e5bUL, 0x11fc0042UL, 0xde62178aUL, 0xdd2b7a31UL,
+    0x12b56df9UL, 0x996653e0UL, 0x56f84428UL, 0xd00eccddUL, 0x1f90db15UL,
+    0x9443e50cUL, 0x5bddf2c4UL, 0x58949f7fUL, 0x970a88b7UL, 0x1cd9b6aeUL,
+    0xd347a166UL, 0x1a4b6dd8UL, 0xd5d57a10UL, 0x5e064409UL, 0x919853c1UL,
+    0x92d13e7aUL, 0x5d4f29b2UL, 0xd69c17abUL, 0x19020063UL, 0xe498176dUL,
+    0x2b0600a5UL, 0xa0d53ebcUL, 0x6f4b2974UL, 0x6c0244cfUL, 0xa39c5307UL,
+    0x284f6d1eUL, 0xe7d17ad6UL, 0x2eddb668UL, 0xe143a1a0UL, 0x6a909fb9UL,
+    0xa50e8871UL, 0xa647e5caUL, 0x69d9f202UL, 0xe20acc1bUL, 0x2d94dbd3UL,
+    0xab625326UL, 0x64fc44eeUL, 0xef2f7af7UL, 0x20b16d3fUL, 0x23f80084UL,
+    0xec66174cUL, 0x67b52955UL, 0xa82b3e9dUL, 0x6127f223UL, 0xaeb9e5ebUL,
+    0x256adbf2UL, 0xeaf4cc3aUL, 0xe9bda181UL, 0x2623b649UL, 0xadf08850UL,
+    0x626e9f98UL, 0x7b6c9ffbUL, 0xb4f28833UL, 0x3f21b62aUL, 0xf0bfa1e2UL,
+    0xf3f6cc59UL, 0x3c68db91UL, 0xb7bbe588UL, 0x7825f240UL, 0xb1293efeUL,
+    0x7eb72936UL, 0xf564172fUL, 0x3afa00e7UL, 0x39b36d5cUL, 0xf62d7a94UL,
+    0x7dfe448dUL, 0xb2605345UL, 0x3496dbb0UL, 0xfb08cc78UL, 0x70dbf261UL,
+    0xbf45e5a9UL, 0xbc0c8812UL, 0x73929fdaUL, 0xf841a1c3UL, 0x37dfb60bUL,
+    0xfed37ab5UL, 0x314d6d7dUL, 0xba9e5364UL, 0x750044acUL, 0x76492917UL,
+    0xb9d73edfUL, 0x320400c6UL, 0xfd9a170eUL, 0x1241289bUL, 0xdddf3f53UL,
+    0x560c014aUL, 0x99921682UL, 0x9adb7b39UL, 0x55456cf1UL, 0xde9652e8UL,
+    0x11084520UL, 0xd804899eUL, 0x179a9e56UL, 0x9c49a04fUL, 0x53d7b787UL,
+    0x509eda3cUL, 0x9f00cdf4UL, 0x14d3f3edUL, 0xdb4de425UL, 0x5dbb6cd0UL,
+    0x92257b18UL, 0x19f64501UL, 0xd66852c9UL, 0xd5213f72UL, 0x1abf28baUL,
+    0x916c16a3UL, 0x5ef2016bUL, 0x97fecdd5UL, 0x5860da1dUL, 0xd3b3e404UL,
+    0x1c2df3ccUL, 0x1f649e77UL, 0xd0fa89bfUL, 0x5b29b7a6UL, 0x94b7a06eUL,
+    0x8db5a00dUL, 0x422bb7c5UL, 0xc9f889dcUL, 0x06669e14UL, 0x052ff3afUL,
+    0xcab1e467UL, 0x4162da7eUL, 0x8efccdb6UL, 0x47f00108UL, 0x886e16c0UL,
+    0x03bd28d9UL, 0xcc233f11UL, 0xcf6a52aaUL, 0x00f44562UL, 0x8b277b7bUL,
+    0x44b96cb3UL, 0xc24fe446UL, 0x0dd1f38eUL, 0x8602cd97UL, 0x499cda5fUL,
+    0x4ad5b7e4UL, 0x854ba02cUL, 0x0e989e35UL, 0xc10689fdUL, 0x080a4543UL,
+    0xc794528bUL, 0x4c476c92UL, 0x83d97b5aUL, 0x809016e1UL, 0x4f0e0129UL,
+    0xc4dd3f30UL, 0x0b4328f8UL, 0xf6d93ff6UL, 0x3947283eUL, 0xb2941627UL,
+    0x7d0a01efUL, 0x7e436c54UL, 0xb1dd7b9cUL, 0x3a0e4585UL, 0xf590524dUL,
+    0x3c9c9ef3UL, 0xf302893bUL, 0x78d1b722UL, 0xb74fa0eaUL, 0xb406cd51UL,
+    0x7b98da99UL, 0xf04be480UL, 0x3fd5f348UL, 0xb9237bbdUL, 0x76bd6c75UL,
+    0xfd6e526cUL, 0x32f045a4UL, 0x31b9281fUL, 0xfe273fd7UL, 0x75f401ceUL,
+    0xba6a1606UL, 0x7366dab8UL, 0xbcf8cd70UL, 0x372bf369UL, 0xf8b5e4a1UL,
+    0xfbfc891aUL, 0x34629ed2UL, 0xbfb1a0cbUL, 0x702fb703UL, 0x692db760UL,
+    0xa6b3a0a8UL, 0x2d609eb1UL, 0xe2fe8979UL, 0xe1b7e4c2UL, 0x2e29f30aUL,
+    0xa5facd13UL, 0x6a64dadbUL, 0xa3681665UL, 0x6cf601adUL, 0xe7253fb4UL,
+    0x28bb287cUL, 0x2bf245c7UL, 0xe46c520fUL, 0x6fbf6c16UL, 0xa0217bdeUL,
+    0x26d7f32bUL, 0xe949e4e3UL, 0x629adafaUL, 0xad04cd32UL, 0xae4da089UL,
+    0x61d3b741UL, 0xea008958UL, 0x259e9e90UL, 0xec92522eUL, 0x230c45e6UL,
+    0xa8df7bffUL, 0x67416c37UL, 0x6408018cUL, 0xab961644UL, 0x2045285dUL,
+    0xefdb3f95UL
+  },
+  {
+    0x00000000UL, 0x24825136UL, 0x4904a26cUL, 0x6d86f35aUL, 0x920944d8UL,
+    0xb68b15eeUL, 0xdb0de6b4UL, 0xff8fb782UL, 0xff638ff1UL, 0xdbe1dec7UL,
+    0xb6672d9dUL, 0x92e57cabUL, 0x6d6acb29UL, 0x49e89a1fUL, 0x246e6945UL,
+    0x00ec3873UL, 0x25b619a3UL, 0x01344895UL, 0x6cb2bbcfUL, 0x4830eaf9UL,
+    0xb7bf5d7bUL, 0x933d0c4dUL, 0xfebbff17UL, 0xda39ae21UL, 0xdad59652UL,
+    0xfe57c764UL, 0x93d1343eUL, 0xb7536508UL, 0x48dcd28aUL, 0x6c5e83bcUL,
+    0x01d870e6UL, 0x255a21d0UL, 0x4b6c3346UL, 0x6fee6270UL, 0x0268912aUL,
+    0x26eac01cUL, 0xd965779eUL, 0xfde726a8UL, 0x9061d5f2UL, 0xb4e384c4UL,
+    0xb40fbcb7UL, 0x908ded81UL, 0xfd0b1edbUL, 0xd9894fedUL, 0x2606f86fUL,
+    0x0284a959UL, 0x6f025a03UL, 0x4b800b35UL, 0x6eda2ae5UL, 0x4a587bd3UL,
+    0x27de8889UL, 0x035cd9bfUL, 0xfcd36e3dUL, 0xd8513f0bUL, 0xb5d7cc51UL,
+    0x91559d67UL, 0x91b9a514UL, 0xb53bf422UL, 0xd8bd0778UL, 0xfc3f564eUL,
+    0x03b0e1ccUL, 0x2732b0faUL, 0x4ab443a0UL, 0x6e361296UL, 0x96d8668cUL,
+    0xb25a37baUL, 0xdfdcc4e0UL, 0xfb5e95d6UL, 0x04d12254UL, 0x20537362UL,
+    0x4dd58038UL, 0x6957d10eUL, 0x69bbe97dUL, 0x4d39b84bUL, 0x20bf4b11UL,
+    0x043d1a27UL, 0xfbb2ada5UL, 0xdf30fc93UL, 0xb2b60fc9UL, 0x96345effUL,
+    0xb36e7f2fUL, 0x97ec2e19UL, 0xfa6add43UL, 0xdee88c75UL, 0x21673bf7UL,
+    0x05e56ac1UL, 0x6863999bUL, 0x4ce1c8adUL, 0x4c0df0deUL, 0x688fa1e8UL,
+    0x050952b2UL, 0x218b0384UL, 0xde04b406UL, 0xfa86e530UL, 0x9700166aUL,
+    0xb382475cUL, 0xddb455caUL, 0xf93604fcUL, 0x94b0f7a6UL, 0xb032a690UL,
+    0x4fbd1112UL, 0x6b3f4024UL, 0x06b9b37eUL, 0x223be248UL, 0x22d7da3bUL,
+    0x06558b0dUL, 0x6bd37857UL, 0x4f512961UL, 0xb0de9ee3UL, 0x945ccfd5UL,
+    0xf9da3c8fUL, 0xdd586db9UL, 0xf8024c69UL, 0xdc801d5fUL, 0xb106ee05UL,
+    0x9584bf33UL, 0x6a0b08b1UL, 0x4e895987UL, 0x230faaddUL, 0x078dfbebUL,
+    0x0761c398UL, 0x23e392aeUL, 0x4e6561f4UL, 0x6ae730c2UL, 0x95688740UL,
+    0xb1ead676UL, 0xdc6c252cUL, 0xf8ee741aUL, 0xf6c1cb59UL, 0xd2439a6fUL,
+    0xbfc56935UL, 0x9b473803UL, 0x64c88f81UL, 0x404adeb7UL, 0x2dcc2dedUL,
+    0x094e7cdbUL, 0x09a244a8UL, 0x2d20159eUL, 0x40a6e6c4UL, 0x6424b7f2UL,
+    0x9bab0070UL, 0xbf295146UL, 0xd2afa21cUL, 0xf62df32aUL, 0xd377d2faUL,
+    0xf7f583ccUL, 0x9a737096UL, 0xbef121a0UL, 0x417e9622UL, 0x65fcc714UL,
+    0x087a344eUL, 0x2cf86578UL, 0x2c145d0bUL, 0x08960c3dUL, 0x6510ff67UL,
+    0x4192ae51UL, 0xbe1d19d3UL, 0x9a9f48e5UL, 0xf719bbbfUL, 0xd39bea89UL,
+    0xbdadf81fUL, 0x992fa929UL, 0xf4a95a73UL, 0xd02b0b45UL, 0x2fa4bcc7UL,
+    0x0b26edf1UL, 0x66a01eabUL, 0x42224f9dUL, 0x42ce77eeUL, 0x664c26d8UL,
+    0x0bcad582UL, 0x2f4884b4UL, 0xd0c73336UL, 0xf4456200UL, 0x99c3915aUL,
+    0xbd41c06cUL, 0x981be1bcUL, 0xbc99b08aUL, 0xd11f43d0UL, 0xf59d12e6UL,
+    0x0a12a564UL, 0x2e90f452UL, 0x43160708UL, 0x6794563eUL, 0x67786e4dUL,
+    0x43fa3f7bUL, 0x2e7ccc21UL, 0x0afe9d17UL, 0xf5712a95UL, 0xd1f37ba3UL,
+    0xbc7588f9UL, 0x98f7d9cfUL, 0x6019add5UL, 0x449bfce3UL, 0x291d0fb9UL,
+    0x0d9f5e8fUL, 0xf210e90dUL, 0xd692b83bUL, 0xbb144b61UL, 0x9f961a57UL,
+    0x9f7a2224UL, 0xbbf87312UL, 0xd67e8048UL, 0xf2fcd17eUL, 0x0d7366fcUL,
+    0x29f137caUL, 0x4477c490UL, 0x60f595a6UL, 0x45afb476UL, 0x612de540UL,
+    0x0cab161aUL, 0x2829472cUL, 0xd7a6f0aeUL, 0xf324a198UL, 0x9ea252c2UL,
+    0xba2003f4UL, 0xbacc3b87UL, 0x9e4e6ab1UL, 0xf3c899ebUL, 0xd74ac8ddUL,
+    0x28c57f5fUL, 0x0c472e69UL, 0x61c1dd33UL, 0x45438c05UL, 0x2b759e93UL,
+    0x0ff7cfa5UL, 0x62713cffUL, 0x46f36dc9UL, 0xb97cda4bUL, 0x9dfe8b7dUL,
+    0xf0787827UL, 0xd4fa2911UL, 0xd4161162UL, 0xf0944054UL, 0x9d12b30eUL,
+    0xb990e238UL, 0x461f55baUL, 0x629d048cUL, 0x0f1bf7d6UL, 0x2b99a6e0UL,
+    0x0ec38730UL, 0x2a41d606UL, 0x47c7255cUL, 0x6345746aUL, 0x9ccac3e8UL,
+    0xb84892deUL, 0xd5ce6184UL, 0xf14c30b2UL, 0xf1a008c1UL, 0xd52259f7UL,
+    0xb8a4aaadUL, 0x9c26fb9bUL, 0x63a94c19UL, 0x472b1d2fUL, 0x2aadee75UL,
+    0x0e2fbf43UL
+  },
+  {
+    0x00000000UL, 0x36f290f3UL, 0x6de521e6UL, 0x5b17b115UL, 0xdbca43ccUL,
+    0xed38d33fUL, 0xb62f622aUL, 0x80ddf2d9UL, 0x6ce581d9UL, 0x5a17112aUL,
+    0x0100a03fUL, 0x37f230ccUL, 0xb72fc215UL, 0x81dd52e6UL, 0xdacae3f3UL,
+    0xec387300UL, 0xd9cb03b2UL, 0xef399341UL, 0xb42e2254UL, 0x82dcb2a7UL,
+    0x0201407eUL, 0x34f3d08dUL, 0x6fe46198UL, 0x5916f16bUL, 0xb52e826bUL,
+    0x83dc1298UL, 0xd8cba38dUL, 0xee39337eUL, 0x6ee4c1a7UL, 0x58165154UL,
+    0x0301e041UL, 0x35f370b2UL, 0x68e70125UL, 0x5e1591d6UL, 0x050220c3UL,
+    0x33f0b030UL, 0xb32d42e9UL, 0x85dfd21aUL, 0xdec8630fUL, 0xe83af3fcUL,
+    0x040280fcUL, 0x32f0100fUL, 0x69e7a11aUL, 0x5f1531e9UL, 0xdfc8c330UL,
+    0xe93a53c3UL, 0xb22de2d6UL, 0x84df7225UL, 0xb12c0297UL, 0x87de9264UL,
+    0xdcc92371UL, 0xea3bb382UL, 0x6ae6415bUL, 0x5c14d1a8UL, 0x070360bdUL,
+    0x31f1f04eUL, 0xddc9834eUL, 0xeb3b13bdUL, 0xb02ca2a8UL, 0x86de325bUL,
+    0x0603c082UL, 0x30f15071UL, 0x6be6e164UL, 0x5d147197UL, 0xd1ce024aUL,
+    0xe73c92b9UL, 0xbc2b23acUL, 0x8ad9b35fUL, 0x0a044186UL, 0x3cf6d175UL,
+    0x67e16060UL, 0x5113f093UL, 0xbd2b8393UL, 0x8bd91360UL, 0xd0cea275UL,
+    0xe63c3286UL, 0x66e1c05fUL, 0x501350acUL, 0x0b04e1b9UL, 0x3df6714aUL,
+    0x080501f8UL, 0x3ef7910bUL, 0x65e0201eUL, 0x5312b0edUL, 0xd3cf4234UL,
+    0xe53dd2c7UL, 0xbe2a63d2UL, 0x88d8f321UL, 0x64e08021UL, 0x521210d2UL,
+    0x0905a1c7UL, 0x3ff73134UL, 0xbf2ac3edUL, 0x89d8531eUL, 0xd2cfe20bUL,
+    0xe43d72f8UL, 0xb929036fUL, 0x8fdb939cUL, 0xd4cc2289UL, 0xe23eb27aUL,
+    0x62e340a3UL, 0x5411d050UL, 0x0f066145UL, 0x39f4f1b6UL, 0xd5cc82b6UL,
+    0xe33e1245UL, 0xb829a350UL, 0x8edb33a3UL, 0x0e06c17aUL, 0x38f45189UL,
+    0x63e3e09cUL, 0x5511706fUL, 0x60e200ddUL, 0x5610902eUL, 0x0d07213bUL,
+    0x3bf5b1c8UL, 0xbb284311UL, 0x8ddad3e2UL, 0xd6cd62f7UL, 0xe03ff204UL,
+    0x0c078104UL, 0x3af511f7UL, 0x61e2a0e2UL, 0x57103011UL, 0xd7cdc2c8UL,
+    0xe13f523bUL, 0xba28e32eUL, 0x8cda73ddUL, 0x78ed02d5UL, 0x4e1f9226UL,
+    0x15082333UL, 0x23fab3c0UL, 0xa3274119UL, 0x95d5d1eaUL, 0xcec260ffUL,
+    0xf830f00cUL, 0x1408830cUL, 0x22fa13ffUL, 0x79eda2eaUL, 0x4f1f3219UL,
+    0xcfc2c0c0UL, 0xf9305033UL, 0xa227e126UL, 0x94d571d5UL, 0xa1260167UL,
+    0x97d49194UL, 0xccc32081UL, 0xfa31b072UL, 0x7aec42abUL, 0x4c1ed258UL,
+    0x1709634dUL, 0x21fbf3beUL, 0xcdc380beUL, 0xfb31104dUL, 0xa026a158UL,
+    0x96d431abUL, 0x1609c372UL, 0x20fb5381UL, 0x7bece294UL, 0x4d1e7267UL,
+    0x100a03f0UL, 0x26f89303UL, 0x7def2216UL, 0x4b1db2e5UL, 0xcbc0403cUL,
+    0xfd32d0cfUL, 0xa62561daUL, 0x90d7f129UL, 0x7cef8229UL, 0x4a1d12daUL,
+    0x110aa3cfUL, 0x27f8333cUL, 0xa725c1e5UL, 0x91d75116UL, 0xcac0e003UL,
+    0xfc3270f0UL, 0xc9c10042UL, 0xff3390b1UL, 0xa42421a4UL, 0x92d6b157UL,
+    0x120b438eUL, 0x24f9d37dUL, 0x7fee6268UL, 0x491cf29bUL, 0xa524819bUL,
+    0x93d61168UL, 0xc8c1a07dUL, 0xfe33308eUL, 0x7eeec257UL, 0x481c52a4UL,
+    0x130be3b1UL, 0x25f97342UL, 0xa923009fUL, 0x9fd1906cUL, 0xc4c62179UL,
+    0xf234b18aUL, 0x72e94353UL, 0x441bd3a0UL, 0x1f0c62b5UL, 0x29fef246UL,
+    0xc5c68146UL, 0xf33411b5UL, 0xa823a0a0UL, 0x9ed13053UL, 0x1e0cc28aUL,
+    0x28fe5279UL, 0x73e9e36cUL, 0x451b739fUL, 0x70e8032dUL, 0x461a93deUL,
+    0x1d0d22cbUL, 0x2bffb238UL, 0xab2240e1UL, 0x9dd0d012UL, 0xc6c76107UL,
+    0xf035f1f4UL, 0x1c0d82f4UL, 0x2aff1207UL, 0x71e8a312UL, 0x471a33e1UL,
+    0xc7c7c138UL, 0xf13551cbUL, 0xaa22e0deUL, 0x9cd0702dUL, 0xc1c401baUL,
+    0xf7369149UL, 0xac21205cUL, 0x9ad3b0afUL, 0x1a0e4276UL, 0x2cfcd285UL,
+    0x77eb6390UL, 0x4119f363UL, 0xad218063UL, 0x9bd31090UL, 0xc0c4a185UL,
+    0xf6363176UL, 0x76ebc3afUL, 0x4019535cUL, 0x1b0ee249UL, 0x2dfc72baUL,
+    0x180f0208UL, 0x2efd92fbUL, 0x75ea23eeUL, 0x4318b31dUL, 0xc3c541c4UL,
+    0xf537d137UL, 0xae206022UL, 0x98d2f0d1UL, 0x74ea83d1UL, 0x42181322UL,
+    0x190fa237UL, 0x2ffd32c4UL, 0xaf20c01dUL, 0x99d250eeUL, 0xc2c5e1fbUL,
+    0xf4377108UL
+  }
+};
+#endif
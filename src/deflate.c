@@ -74,6 +74,7 @@ typedef block_state (*compress_func) OF((deflate_state *s, int flush));
 /* Compression function. Returns the block state after the call. */
 
 local void fill_window    OF((deflate_state *s));
+local void fill_history   OF((deflate_state *s, const Bytef *data, uInt size));
 local block_state deflate_stored OF((deflate_state *s, int flush));
 local block_state deflate_fast   OF((deflate_state *s, int flush));
 #ifndef FASTEST
@@ -81,7 +82,19 @@ local block_state deflate_slow   OF((deflate_state *s, int flush));
 #endif
 local block_state deflate_rle    OF((deflate_state *s, int flush));
 local block_state deflate_huff   OF((deflate_state *s, int flush));
+local uInt run_length     OF((Bytef *scan, unsigned c, uInt max));
 local void lm_init        OF((deflate_state *s));
+local void lm_start       OF((deflate_state *s));
+local void hash_clear     OF((deflate_state *s, ulg used));
+local int  skip_region    OF((deflate_state *s));
+local void leave_region   OF((deflate_state *s));
+local int  probe_matches  OF((deflate_state *s, uInt n));
+local void rsync_scan     OF((deflate_state *s));
+local void point_emit     OF((deflate_state *s, int full));
+#ifdef BIG_MEM
+local void big_begin      OF((deflate_state *s));
+local void big_end        OF((deflate_state *s));
+#endif
 local void putShortMSB    OF((deflate_state *s, uInt b));
 local void flush_pending  OF((z_streamp strm));
 local int read_buf        OF((z_streamp strm, Bytef *buf, unsigned size));
@@ -109,6 +122,40 @@ local  void check_match OF((deflate_state *s, IPos start, IPos match,
 #endif
 /* Matches of length 3 are discarded if their distance exceeds TOO_FAR */
 
+#ifdef BIG_MEM
+#  define BIG_MAX 0x7fffffffUL
+/* Largest input used as the window, so that block_start fits in a long */
+#  define BIG_END(s) { if ((s)->own_window != Z_NULL) big_end(s); }
+#else
+#  define BIG_END(s)
+#endif
+
+#ifndef PROBE_MIN
+#  define PROBE_MIN 4096
+#endif
+/* A stored block of at least PROBE_MIN bytes from deflate_fast() or
+ * deflate_slow() below level 9 starts an incompressible region, in which the
+ * match search is skipped until probe_matches() sees repeated strings in the
+ * input to come.  Define NO_PROBE to always run the match search.
+ */
+
+#define PROBE_LEN 4096
+#define PROBE_BITS 12
+#define PROBE_STEP 8
+/* deflate_huff() probes the input PROBE_LEN bytes at a time, and
+ * probe_matches() looks up those strings in a 2^PROBE_BITS table of the
+ * strings at every PROBE_STEP positions before them
+ */
+#define PROBE_HASH(p) ((unsigned)(((((ulg)(p)[0] | ((ulg)(p)[1] << 8) | \
+    ((ulg)(p)[2] << 16) | ((ulg)(p)[3] << 24)) * 2654435761UL) & \
+    0xffffffffUL) >> (32 - PROBE_BITS)))
+
+#define RSYNC_MIN_BITS 8
+#define RSYNC_MAX_BITS 24
+/* Range of the deflateRsyncable() bits parameter.  The rsyncable points are
+ * at least 2^(bits-4) bytes apart.
+ */
+
 /* Values for max_lazy_match, good_match and max_chain_length, depending on
  * the desired pack level (0..9). The values given below have been tuned to
  * exclude worst case performance for pathological files. Better values may be
@@ -268,9 +315,14 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
         windowBits -= 16;
     }
 #endif
-    if (memLevel < 1 || memLevel > MAX_MEM_LEVEL || method != Z_DEFLATED ||
-        windowBits < 8 || windowBits > 15 || level < 0 || level > 9 ||
-        strategy < 0 || strategy > Z_FIXED) {
+    if (memLevel < 1 || memLevel > MAX_MEM_LEVEL || windowBits < 8 ||
+#ifdef DEFLATE64
+        (method == Z_DEFLATED64 && wrap == 0 ? windowBits > 16 :
+         method != Z_DEFLATED || windowBits > 15) ||
+#else
+        method != Z_DEFLATED || windowBits > 15 ||
+#endif
+        level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED) {
         return Z_STREAM_ERROR;
     }
     if (windowBits == 8) windowBits = 9;  /* until 256-byte window bug fixed */
@@ -295,6 +347,9 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
     s->head   = (Posf *)  ZALLOC(strm, s->hash_size, sizeof(Pos));
 
     s->high_water = 0;      /* nothing written to s->window yet */
+#ifdef BIG_MEM
+    s->own_window = Z_NULL;
+#endif
 
     s->lit_bufsize = 1 << (memLevel + 6); /* 16K elements by default */
 
@@ -315,6 +370,10 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
     s->level = level;
     s->strategy = strategy;
     s->method = (Byte)method;
+    s->rsync_bits = 0;
+    s->point = Z_NULL;
+    s->point_span = 0;
+    s->point_full = 0;
 
     return deflateReset(strm);
 }
@@ -326,10 +385,7 @@ int ZEXPORT deflateSetDictionary (strm, dictionary, dictLength)
     uInt  dictLength;
 {
     deflate_state *s;
-    uInt str, n;
     int wrap;
-    unsigned avail;
-    z_const unsigned char *next;
 
     if (strm == Z_NULL || strm->state == Z_NULL || dictionary == Z_NULL)
         return Z_STREAM_ERROR;
@@ -356,10 +412,31 @@ int ZEXPORT deflateSetDictionary (strm, dictionary, dictLength)
     }
 
     /* insert dictionary into window and hash */
+    fill_history(s, dictionary, dictLength);
+    s->wrap = wrap;
+    return Z_OK;
+}
+
+/* ===========================================================================
+ * Copy size bytes from data into the window at strstart, and insert their
+ * strings into the hash table, as history for the matches that follow.
+ * s->wrap must be zero, so that the data is not taken as input for the check
+ * value.
+ */
+local void fill_history(s, data, size)
+    deflate_state *s;
+    const Bytef *data;
+    uInt size;
+{
+    z_streamp strm = s->strm;
+    uInt str, n;
+    unsigned avail;
+    z_const unsigned char *next;
+
     avail = strm->avail_in;
     next = strm->next_in;
-    strm->avail_in = dictLength;
-    strm->next_in = (z_const Bytef *)dictionary;
+    strm->avail_in = size;
+    strm->next_in = (z_const Bytef *)data;
     fill_window(s);
     while (s->lookahead >= MIN_MATCH) {
         str = s->strstart;
@@ -384,7 +461,107 @@ int ZEXPORT deflateSetDictionary (strm, dictionary, dictLength)
     s->match_available = 0;
     strm->next_in = next;
     strm->avail_in = avail;
-    s->wrap = wrap;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflatePrepareDictionary (strm, dictionary, dictLength, dict)
+    z_streamp strm;
+    const Bytef *dictionary;
+    uInt  dictLength;
+    z_dictp *dict;
+{
+    deflate_state *s;
+    z_dictp d;
+    uInt str, h;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || dictionary == Z_NULL ||
+        dict == Z_NULL)
+        return Z_STREAM_ERROR;
+    s = strm->state;
+
+    d = (z_dictp) ZALLOC(strm, 1, sizeof(z_dict));
+    if (d == Z_NULL) return Z_MEM_ERROR;
+    d->adler = adler32(adler32(0L, Z_NULL, 0), dictionary, dictLength);
+    if (dictLength > s->w_size) {
+        dictionary += dictLength - s->w_size;   /* use the tail */
+        dictLength = s->w_size;
+    }
+    d->w_bits = s->w_bits;
+    d->hash_bits = s->hash_bits;
+    d->length = dictLength;
+    d->window = (Bytef *) ZALLOC(strm, dictLength + 1, sizeof(Byte));
+    d->head = (Posf *) ZALLOC(strm, s->hash_size, sizeof(Pos));
+    d->prev = (Posf *) ZALLOC(strm, dictLength + 1, sizeof(Pos));
+    if (d->window == Z_NULL || d->head == Z_NULL || d->prev == Z_NULL) {
+        deflateFreeDictionary(strm, d);
+        return Z_MEM_ERROR;
+    }
+
+    /* insert the strings as deflateSetDictionary() would, at positions
+       0..dictLength-MIN_MATCH of an empty window */
+    zmemcpy(d->window, dictionary, dictLength);
+    zmemzero((Bytef *)d->head, s->hash_size * sizeof(Pos));
+    if (dictLength >= MIN_MATCH) {
+        h = d->window[0];
+        UPDATE_HASH(s, h, d->window[1]);
+        for (str = 0; str <= dictLength - MIN_MATCH; str++) {
+            UPDATE_HASH(s, h, d->window[str + MIN_MATCH-1]);
+#ifndef FASTEST
+            d->prev[str] = d->head[h];
+#endif
+            d->head[h] = (Pos)str;
+        }
+    }
+    *dict = d;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateUseDictionary (strm, dict)
+    z_streamp strm;
+    z_dictp dict;
+{
+    deflate_state *s;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || dict == Z_NULL)
+        return Z_STREAM_ERROR;
+    s = strm->state;
+    if (s->wrap == 2 || (s->wrap == 1 && s->status != INIT_STATE) ||
+        s->strstart || s->lookahead || dict->w_bits != s->w_bits ||
+        dict->hash_bits != s->hash_bits)
+        return Z_STREAM_ERROR;
+
+    /* when using zlib wrappers, use the dictionary's Adler-32 */
+    if (s->wrap == 1)
+        strm->adler = dict->adler;
+
+    /* the state that deflateSetDictionary() would leave, without the hashing */
+    zmemcpy(s->window, dict->window, dict->length);
+    zmemcpy((Bytef *)s->head, (Bytef *)dict->head,
+            s->hash_size * sizeof(Pos));
+#ifndef FASTEST
+    zmemcpy((Bytef *)s->prev, (Bytef *)dict->prev,
+            dict->length * sizeof(Pos));
+#endif
+    s->strstart = dict->length;
+    s->block_start = (long)s->strstart;
+    s->insert = dict->length < MIN_MATCH-1 ? dict->length : MIN_MATCH-1;
+    s->match_length = s->prev_length = MIN_MATCH-1;
+    s->match_available = 0;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateFreeDictionary (strm, dict)
+    z_streamp strm;
+    z_dictp dict;
+{
+    if (strm == Z_NULL || strm->zfree == (free_func)0 || dict == Z_NULL)
+        return Z_STREAM_ERROR;
+    if (dict->prev != Z_NULL) ZFREE(strm, dict->prev);
+    if (dict->head != Z_NULL) ZFREE(strm, dict->head);
+    if (dict->window != Z_NULL) ZFREE(strm, dict->window);
+    ZFREE(strm, dict);
     return Z_OK;
 }
 
@@ -417,6 +594,10 @@ int ZEXPORT deflateResetKeep (strm)
 #endif
         adler32(0L, Z_NULL, 0);
     s->last_flush = Z_NO_FLUSH;
+    s->rsync_hash = 0;
+    s->rsync_end = s->rsync_last = 0;
+    s->rsync_hit = 0;
+    s->point_next = s->point_span;
 
     _tr_init(s);
 
@@ -524,6 +705,8 @@ int ZEXPORT deflateParams(strm, level, strategy)
         s->max_chain_length = configuration_table[level].max_chain;
     }
     s->strategy = strategy;
+    s->skip_matches = 0;
+    s->last_stored = 0;
     return err;
 }
 
@@ -546,6 +729,50 @@ int ZEXPORT deflateTune(strm, good_length, max_lazy, nice_length, max_chain)
     return Z_OK;
 }
 
+/* ========================================================================= */
+int ZEXPORT deflateRsyncable(strm, bits)
+    z_streamp strm;
+    int bits;
+{
+    deflate_state *s;
+
+    if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    if (bits != 0 && (bits < RSYNC_MIN_BITS || bits > RSYNC_MAX_BITS))
+        return Z_STREAM_ERROR;
+    s = strm->state;
+    s->rsync_bits = bits;
+    s->rsync_hash = 0;
+    s->rsync_end = s->rsync_last = strm->total_in;
+    s->rsync_hit = 0;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateAccessPoints(strm, span, full, point, point_desc)
+    z_streamp strm;
+    uLong span;
+    int full;
+    point_func point;
+    void FAR *point_desc;
+{
+    deflate_state *s;
+
+    if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    s = strm->state;
+    if (span == 0 || point == Z_NULL) {
+        s->point = Z_NULL;
+        s->point_span = 0;
+        s->point_full = 0;
+        return Z_OK;
+    }
+    s->point = point;
+    s->point_desc = point_desc;
+    s->point_span = span;
+    s->point_next = strm->total_in + span;
+    s->point_full = full != 0;
+    return Z_OK;
+}
+
 /* =========================================================================
  * For the default windowBits of 15 and memLevel of 8, this function returns
  * a close to exact, as well as small, upper bound on the compressed size.
@@ -611,8 +838,18 @@ uLong ZEXPORT deflateBound(strm, sourceLen)
         wraplen = 6;
     }
 
+    /* each rsyncable point can add an empty stored block and split a stored
+       block, and they are at least 2^(rsync_bits-4) bytes apart */
+    if (s->rsync_bits)
+        complen += ((sourceLen >> (s->rsync_bits - 4)) + 1) * 10;
+
+    /* and so can each forced access point, which are span bytes apart */
+    if (s->point_full)
+        complen += (sourceLen / s->point_span + 1) * 10;
+
     /* if not default parameters, return conservative bound */
-    if (s->w_bits != 15 || s->hash_bits != 8 + 7)
+    if (s->w_bits != 15 || s->hash_bits != 8 + 7 || s->rsync_bits ||
+        s->point_full)
         return complen + wraplen;
 
     /* default settings: return tight bound for that case */
@@ -894,20 +1131,69 @@ int ZEXPORT deflate (strm, flush)
         ERR_RETURN(strm, Z_BUF_ERROR);
     }
 
-    /* Start a new block or continue the current one.
+#ifdef BIG_MEM
+    /* For a one-shot deflate() of more than a window of input, compress
+     * directly from the input, without copying it or sliding the window.
+     */
+    if (flush == Z_FINISH && s->status == BUSY_STATE && s->strstart == 0 &&
+        s->lookahead == 0 && s->block_start == 0L &&
+        strm->avail_in > 2 * s->w_size && (ulg)strm->avail_in <= BIG_MAX &&
+        !s->rsync_bits && !(s->point_full && s->point != Z_NULL))
+        big_begin(s);
+#endif
+
+    /* Start a new block or continue the current one.  In rsyncable mode, and
+     * when forcing access points, the input is compressed up to the next
+     * rsyncable or access point at a time, and a full flush is done at each
+     * point.
      */
-    if (strm->avail_in != 0 || s->lookahead != 0 ||
-        (flush != Z_NO_FLUSH && s->status != FINISH_STATE)) {
+    for (;;) {
         block_state bstate;
+        int forced = 0;     /* true if flushing at an rsyncable or access point */
+        int fl = flush;     /* flush for this pass */
+        uInt cut = 0;       /* input held back after the point */
+        uLong left;         /* input up to the next access point */
+
+        if (s->rsync_bits && s->status != FINISH_STATE) {
+            if (!s->rsync_hit)
+                rsync_scan(s);
+            if (s->rsync_hit) {
+                cut = strm->avail_in - (uInt)(s->rsync_end - strm->total_in);
+                strm->avail_in -= cut;
+                forced = 1;
+                fl = Z_FULL_FLUSH;
+            }
+        }
+        if (s->point_full && s->point != Z_NULL &&
+            s->status != FINISH_STATE) {
+            left = s->point_next - strm->total_in;
+            if (left < strm->avail_in ||
+                (left == strm->avail_in && flush != Z_FINISH)) {
+                cut += strm->avail_in - (uInt)left;
+                strm->avail_in = (uInt)left;
+                forced = 1;
+                fl = Z_FULL_FLUSH;
+            }
+        }
+        if (strm->avail_in == 0 && s->lookahead == 0 &&
+            (fl == Z_NO_FLUSH || s->status == FINISH_STATE))
+            break;
 
-        bstate = s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
-                    (s->strategy == Z_RLE ? deflate_rle(s, flush) :
-                        (*(configuration_table[s->level].func))(s, flush));
+        do {
+            s->redispatch = 0;
+            bstate = s->strategy == Z_HUFFMAN_ONLY || s->skip_matches ?
+                        deflate_huff(s, fl) :
+                        (s->strategy == Z_RLE ? deflate_rle(s, fl) :
+                            (*(configuration_table[s->level].func))(s, fl));
+        } while (s->redispatch && bstate == need_more &&
+                 strm->avail_out != 0);
 
         if (bstate == finish_started || bstate == finish_done) {
             s->status = FINISH_STATE;
         }
         if (bstate == need_more || bstate == finish_started) {
+            BIG_END(s);
+            strm->avail_in += cut;
             if (strm->avail_out == 0) {
                 s->last_flush = -1; /* avoid BUF_ERROR next call, see above */
             }
@@ -921,14 +1207,14 @@ int ZEXPORT deflate (strm, flush)
              */
         }
         if (bstate == block_done) {
-            if (flush == Z_PARTIAL_FLUSH) {
+            if (fl == Z_PARTIAL_FLUSH) {
                 _tr_align(s);
-            } else if (flush != Z_BLOCK) { /* FULL_FLUSH or SYNC_FLUSH */
+            } else if (fl != Z_BLOCK) { /* FULL_FLUSH or SYNC_FLUSH */
                 _tr_stored_block(s, (char*)0, 0L, 0);
                 /* For a full flush, this empty block will be recognized
                  * as a special marker by inflate_sync().
                  */
-                if (flush == Z_FULL_FLUSH) {
+                if (fl == Z_FULL_FLUSH) {
                     CLEAR_HASH(s);             /* forget history */
                     if (s->lookahead == 0) {
                         s->strstart = 0;
@@ -937,13 +1223,28 @@ int ZEXPORT deflate (strm, flush)
                     }
                 }
             }
+            if (forced) {
+                /* what follows must not depend on what came before */
+                if (strm->total_in == s->rsync_end)
+                    s->rsync_hit = 0;
+                if (s->point_full && s->point != Z_NULL &&
+                    strm->total_in == s->point_next)
+                    point_emit(s, 1);
+                s->skip_matches = 0;
+                s->last_stored = 0;
+                strm->avail_in += cut;
+            }
             flush_pending(strm);
             if (strm->avail_out == 0) {
+              BIG_END(s);
               s->last_flush = -1; /* avoid BUF_ERROR at next call, see above */
               return Z_OK;
             }
         }
+        if (!forced)
+            break;
     }
+    BIG_END(s);
     Assert(strm->avail_out > 0, "bug2");
 
     if (flush != Z_FINISH) return Z_OK;
@@ -975,6 +1276,121 @@ int ZEXPORT deflate (strm, flush)
     return s->pending != 0 ? Z_OK : Z_STREAM_END;
 }
 
+/* ========================================================================= */
+int ZEXPORT deflateV (strm, in, nin, out, nout, flush)
+    z_streamp strm;
+    z_vecp in;
+    unsigned nin;
+    z_vecp out;
+    unsigned nout;
+    int flush;
+{
+    unsigned i = 0, o = 0, last;
+    int ret = Z_BUF_ERROR;
+
+    if (strm == Z_NULL || strm->state == Z_NULL ||
+        (in == Z_NULL && nin) || (out == Z_NULL && nout))
+        return Z_STREAM_ERROR;
+
+    /* call deflate() on each pair of input and output segments, flushing only
+       with the last input segment -- deflate() returns when either one is
+       used up, so only the one used up is advanced past */
+    for (;;) {
+        while (i < nin && in[i].len == 0)
+            i++;
+        while (o < nout && out[o].len == 0)
+            o++;
+        if (o == nout)
+            break;
+        last = i + 1;
+        while (last < nin && in[last].len == 0)
+            last++;
+        last = last >= nin;
+        strm->next_in = i < nin ? in[i].base : Z_NULL;
+        strm->avail_in = i < nin ? in[i].len : 0;
+        strm->next_out = out[o].base;
+        strm->avail_out = out[o].len;
+        ret = deflate(strm, last ? flush : Z_NO_FLUSH);
+        if (i < nin) {
+            in[i].base = (Bytef *)strm->next_in;
+            in[i].len = strm->avail_in;
+        }
+        out[o].base = strm->next_out;
+        out[o].len = strm->avail_out;
+        if (ret != Z_OK || (last && strm->avail_in == 0 &&
+                            strm->avail_out != 0))
+            break;
+    }
+    return ret;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateBatch (strm, dict, dest, destLen, source, sourceLen, n)
+    z_streamp strm;
+    z_dictp dict;
+    Bytef * const *dest;
+    uLongf *destLen;
+    const Bytef * const *source;
+    const uLong *sourceLen;
+    unsigned n;
+{
+    deflate_state *s;
+    unsigned i;
+    ulg used;
+    int ret, err = Z_OK;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || (n &&
+        (dest == Z_NULL || destLen == Z_NULL || source == Z_NULL ||
+         sourceLen == Z_NULL)))
+        return Z_STREAM_ERROR;
+    s = strm->state;
+
+    used = s->window_size;          /* history unknown, so clear it all */
+    for (i = 0;; i++) {
+        /* start a new stream, where the hash table is filled from the
+           dictionary if there is one, and otherwise only the entries used
+           by the last record are cleared -- this is also done after the last
+           record, to leave strm as deflateReset() would */
+        ret = deflateResetKeep(strm);
+        if (ret != Z_OK)
+            return ret;
+        if (dict == Z_NULL || i == n)
+            hash_clear(s, used);
+        lm_start(s);
+        if (i == n)
+            break;
+        used = s->window_size;
+        if (dict != Z_NULL) {
+            ret = deflateUseDictionary(strm, dict);
+            if (ret != Z_OK)
+                return ret;
+        }
+
+        strm->next_in = (z_const Bytef *)source[i];
+        strm->avail_in = (uInt)sourceLen[i];
+        strm->next_out = dest[i];
+        strm->avail_out = (uInt)destLen[i];
+        if ((uLong)strm->avail_in != sourceLen[i] ||
+            (uLong)strm->avail_out != destLen[i])
+            ret = Z_BUF_ERROR;
+        else
+            ret = deflate(strm, Z_FINISH);
+        if (ret == Z_STREAM_END)
+            destLen[i] = strm->total_out;
+        else if (ret == Z_OK || ret == Z_BUF_ERROR) {
+            destLen[i] = 0;
+            err = Z_BUF_ERROR;
+        }
+        else
+            return ret;
+
+        /* a record shorter than the window never slid it */
+        if (strm->total_in + (dict == Z_NULL ? 0 : dict->length) < s->w_size)
+            used = s->strstart + s->lookahead;
+    }
+    return err;
+}
+
 /* ========================================================================= */
 int ZEXPORT deflateEnd (strm)
     z_streamp strm;
@@ -1066,6 +1482,163 @@ int ZEXPORT deflateCopy (dest, source)
 #endif /* MAXSEG_64K */
 }
 
+/* deflateSave() checkpoint version, and bytes in a checkpoint besides the
+ * history: four header bytes, 17 four-byte and six eight-byte fields, and
+ * the Adler-32 check value
+ */
+#define SAVE_VERSION 1
+#define SAVE_SIZE (4 + 17 * 4 + 6 * 8 + 4)
+
+/* ========================================================================= */
+int ZEXPORT deflateSave (strm, buf, len)
+    z_streamp strm;
+    Bytef *buf;
+    uLong *len;
+{
+    deflate_state *s;
+    Bytef *next;
+    uInt have;
+    uLong need;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || len == Z_NULL)
+        return Z_STREAM_ERROR;
+    s = strm->state;
+
+    /* only between blocks, with all of the compressed data delivered but the
+       bits that do not fill a byte */
+    if ((s->status != INIT_STATE && s->status != BUSY_STATE) ||
+        s->pending != 0 || s->lookahead != 0 || s->match_available ||
+        s->last_lit != 0 || s->block_start != (long)s->strstart)
+        return Z_STREAM_ERROR;
+
+    /* the history is what matches can still refer to */
+    have = s->strstart < s->w_size ? s->strstart : s->w_size;
+    need = SAVE_SIZE + have;
+    if (buf == Z_NULL || *len < need) {
+        *len = need;
+        return buf == Z_NULL ? Z_OK : Z_BUF_ERROR;
+    }
+
+    /* the parameters that restoring checks come first */
+    next = buf;
+    *next++ = 'z';
+    *next++ = 'd';
+    *next++ = SAVE_VERSION;
+    *next++ = s->status == BUSY_STATE;
+    next = zputbe(next, (uLong)s->level, 4);
+    next = zputbe(next, (uLong)s->strategy, 4);
+    next = zputbe(next, (uLong)s->wrap, 4);
+    next = zputbe(next, (uLong)s->w_bits, 4);
+    next = zputbe(next, (uLong)s->bi_valid, 4);
+    next = zputbe(next, (uLong)s->rsync_bits, 4);
+    next = zputbe(next, have, 4);
+    next = zputbe(next, s->good_match, 4);
+    next = zputbe(next, s->max_lazy_match, 4);
+    next = zputbe(next, s->nice_match, 4);
+    next = zputbe(next, s->max_chain_length, 4);
+    next = zputbe(next, (uLong)(s->last_flush + 1), 4);
+    next = zputbe(next, s->bi_buf, 4);
+    next = zputbe(next, s->rsync_hash, 4);
+    next = zputbe(next, (uLong)s->rsync_hit, 4);
+    next = zputbe(next, (uLong)s->point_full, 4);
+    next = zputbe(next, strm->adler, 4);
+    next = zputbe(next, s->rsync_end, 8);
+    next = zputbe(next, s->rsync_last, 8);
+    next = zputbe(next, s->point_span, 8);
+    next = zputbe(next, s->point_next, 8);
+    next = zputbe(next, strm->total_in, 8);
+    next = zputbe(next, strm->total_out, 8);
+    zmemcpy(next, s->window + s->strstart - have, have);
+    next += have;
+    next = zputbe(next, adler32(1L, buf, (uInt)(next - buf)), 4);
+    Assert((uLong)(next - buf) == need, "deflateSave size mismatch");
+    *len = need;
+    return Z_OK;
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateRestore (strm, buf, len)
+    z_streamp strm;
+    const Bytef *buf;
+    uLong len;
+{
+    deflate_state *s;
+    const Bytef *next;
+    int level, strategy, wrap, bits, rsync;
+    uInt have;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || buf == Z_NULL ||
+        strm->zalloc == (alloc_func)0 || strm->zfree == (free_func)0)
+        return Z_STREAM_ERROR;
+    s = strm->state;
+
+    /* check that the checkpoint is for the same window size, then check the
+       checkpoint */
+    if (len < SAVE_SIZE || buf[0] != 'z' || buf[1] != 'd' ||
+        buf[2] != SAVE_VERSION || buf[3] > 1)
+        return Z_DATA_ERROR;
+    next = buf + 16;
+    if (zgetbe(&next, 4) != (uLong)s->w_bits)
+        return Z_STREAM_ERROR;
+    if (len > SAVE_SIZE + s->w_size)
+        return Z_DATA_ERROR;
+    next = buf + len - 4;
+    if (zgetbe(&next, 4) != adler32(1L, buf, (uInt)(len - 4)))
+        return Z_DATA_ERROR;
+    next = buf + 4;
+    level = (int)zgetbe(&next, 4);
+    strategy = (int)zgetbe(&next, 4);
+    wrap = (int)zgetbe(&next, 4);
+    next += 4;                          /* w_bits, checked above */
+    bits = (int)zgetbe(&next, 4);
+    rsync = (int)zgetbe(&next, 4);
+    have = (uInt)zgetbe(&next, 4);
+    if (level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED ||
+        wrap < 0 || wrap > 2 || bits < 0 || bits > Buf_size ||
+        (rsync != 0 && (rsync < RSYNC_MIN_BITS || rsync > RSYNC_MAX_BITS)) ||
+        have > s->w_size || len != SAVE_SIZE + have)
+        return Z_DATA_ERROR;
+#ifdef FASTEST
+    if (level != 0) level = 1;
+#endif
+
+    /* start over with the saved parameters, and fill the window and hash
+       table with the history */
+    deflateResetKeep(strm);
+    s->level = level;
+    s->strategy = strategy;
+    lm_init(s);
+    s->good_match = (uInt)zgetbe(&next, 4);
+    s->max_lazy_match = (uInt)zgetbe(&next, 4);
+    s->nice_match = (int)zgetbe(&next, 4);
+    s->max_chain_length = (uInt)zgetbe(&next, 4);
+    /* limit the tuning to that of level 9 */
+    if (s->good_match > 32) s->good_match = 32;
+    if (s->max_lazy_match > MAX_MATCH) s->max_lazy_match = MAX_MATCH;
+    if (s->nice_match < 0 || s->nice_match > MAX_MATCH)
+        s->nice_match = MAX_MATCH;
+    if (s->max_chain_length > 4096) s->max_chain_length = 4096;
+    s->last_flush = (int)zgetbe(&next, 4) - 1;
+    s->bi_buf = (ush)zgetbe(&next, 4);
+    s->bi_valid = bits;
+    s->rsync_bits = rsync;
+    s->rsync_hash = (uInt)zgetbe(&next, 4);
+    s->rsync_hit = (int)zgetbe(&next, 4);
+    s->point_full = (int)zgetbe(&next, 4);
+    strm->adler = zgetbe(&next, 4);
+    s->rsync_end = zgetbe(&next, 8);
+    s->rsync_last = zgetbe(&next, 8);
+    s->point_span = zgetbe(&next, 8);
+    s->point_next = zgetbe(&next, 8);
+    s->wrap = 0;
+    fill_history(s, buf + len - 4 - have, have);
+    s->wrap = wrap;
+    s->status = buf[3] ? BUSY_STATE : INIT_STATE;
+    strm->total_in = zgetbe(&next, 8);      /* after fill_history() adds */
+    strm->total_out = zgetbe(&next, 8);
+    return Z_OK;
+}
+
 /* ===========================================================================
  * Read a new buffer from the current input stream, update the adler32
  * and total number of bytes read.  All deflate() input goes through
@@ -1085,15 +1658,16 @@ local int read_buf(strm, buf, size)
 
     strm->avail_in  -= len;
 
-    zmemcpy(buf, strm->next_in, len);
     if (strm->state->wrap == 1) {
-        strm->adler = adler32(strm->adler, buf, len);
+        strm->adler = adler32_copy(strm->adler, buf, strm->next_in, len);
     }
 #ifdef GZIP
     else if (strm->state->wrap == 2) {
-        strm->adler = crc32(strm->adler, buf, len);
+        strm->adler = crc32_copy(strm->adler, buf, strm->next_in, len);
     }
 #endif
+    else
+        zmemcpy(buf, strm->next_in, len);
     strm->next_in  += len;
     strm->total_in += len;
 
@@ -1106,9 +1680,18 @@ local int read_buf(strm, buf, size)
 local void lm_init (s)
     deflate_state *s;
 {
-    s->window_size = (ulg)2L*s->w_size;
-
     CLEAR_HASH(s);
+    lm_start(s);
+}
+
+/* ===========================================================================
+ * Initialize the "longest match" routines for a new zlib stream, except for
+ * the hash table, which the caller has made empty
+ */
+local void lm_start (s)
+    deflate_state *s;
+{
+    s->window_size = (ulg)2L*s->w_size;
 
     /* Set the default configuration parameters:
      */
@@ -1124,6 +1707,9 @@ local void lm_init (s)
     s->match_length = s->prev_length = MIN_MATCH-1;
     s->match_available = 0;
     s->ins_h = 0;
+    s->last_stored = 0;
+    s->skip_matches = 0;
+    s->redispatch = 0;
 #ifndef FASTEST
 #ifdef ASMV
     match_init(); /* initialize the asm code */
@@ -1131,6 +1717,37 @@ local void lm_init (s)
 #endif
 }
 
+/* ===========================================================================
+ * Empty the hash table after a stream that put only the strings at window
+ * positions 0..used-1 in it, and did not slide the window.  Each of those
+ * strings is hashed again to clear its entry, which is much faster than
+ * clearing the whole table when used is small, as for short records.
+ */
+local void hash_clear (s, used)
+    deflate_state *s;
+    ulg used;
+{
+    uInt str, h;
+
+    if (used >= s->w_size || used > (s->hash_size >> 2)) {
+        CLEAR_HASH(s);
+        return;
+    }
+
+    /* the hash of a string depends only on its MIN_MATCH bytes, which are
+       the same as when it was inserted, since nothing has been read since */
+    h = s->window[0];
+    UPDATE_HASH(s, h, s->window[1]);
+    for (str = 0; str < (uInt)used; str++) {
+        UPDATE_HASH(s, h, s->window[str + MIN_MATCH-1]);
+        s->head[h] = NIL;
+    }
+#ifdef DEBUG
+    for (h = 0; h < s->hash_size; h++)
+        Assert(s->head[h] == NIL, "hash entry not cleared");
+#endif
+}
+
 #ifndef FASTEST
 /* ===========================================================================
  * Set match_start to the longest match starting at the given string and
@@ -1395,6 +2012,12 @@ local void fill_window(s)
     unsigned more;    /* Amount of free space at the end of the window. */
     uInt wsize = s->w_size;
 
+#ifdef BIG_MEM
+    /* the input is used up, or nearly, so go back to the allocated window */
+    if (s->own_window != Z_NULL)
+        big_end(s);
+#endif
+
     Assert(s->lookahead < MIN_LOOKAHEAD, "already enough lookahead");
 
     do {
@@ -1456,10 +2079,8 @@ local void fill_window(s)
          *    more == window_size - lookahead - strstart
          * => more >= window_size - (MIN_LOOKAHEAD-1 + WSIZE + MAX_DIST-1)
          * => more >= window_size - 2*WSIZE + 2
-         * In the BIG_MEM or MMAP case (not yet supported),
-         *   window_size == input_size + MIN_LOOKAHEAD  &&
-         *   strstart + s->lookahead <= input_size => more >= MIN_LOOKAHEAD.
-         * Otherwise, window_size == 2*WSIZE so more >= 2.
+         * In the BIG_MEM case, the input is no longer the window here.
+         * So window_size == 2*WSIZE so more >= 2.
          * If there was sliding, more >= WSIZE. So in all cases, more >= 2.
          */
         Assert(more >= 2, "more < 2");
@@ -1542,6 +2163,9 @@ local void fill_window(s)
                 (ulg)((long)s->strstart - s->block_start), \
                 (last)); \
    s->block_start = s->strstart; \
+   if (s->point != Z_NULL && !s->point_full && !(last) && \
+       s->strm->total_in - s->lookahead >= s->point_next) \
+       point_emit(s, 0); \
    flush_pending(s->strm); \
    Tracev((stderr,"[FLUSH]")); \
 }
@@ -1552,6 +2176,286 @@ local void fill_window(s)
    if (s->strm->avail_out == 0) return (last) ? finish_started : need_more; \
 }
 
+/* ===========================================================================
+ * Check whether the block just emitted by deflate_fast() or deflate_slow()
+ * starts an incompressible region.  If so, switch to literals only and ask
+ * deflate() to select deflate_huff() for the following input.  Such input
+ * still gets stored blocks from _tr_flush_block(), without first paying for
+ * the match search.  Return true if the switch was made.
+ */
+local int skip_region(s)
+    deflate_state *s;
+{
+#ifdef NO_PROBE
+    s->last_stored = 0;
+    return 0;
+#else
+    if (s->last_stored < PROBE_MIN || s->level == 9 ||
+        (s->strategy != Z_DEFAULT_STRATEGY && s->strategy != Z_FILTERED)) {
+        s->last_stored = 0;
+        return 0;
+    }
+    s->last_stored = 0;
+    s->skip_matches = 1;
+    s->skipped = 0;
+    s->redispatch = 1;
+    return 1;
+#endif
+}
+
+/* ===========================================================================
+ * Return to the match search at the end of an incompressible region, once
+ * deflate_huff() sees that the input has become compressible again.  The
+ * strings skipped in the meantime are inserted in the hash chains first,
+ * since the repeats that were found may well be of those strings.
+ */
+local void leave_region(s)
+    deflate_state *s;
+{
+    uInt str, n;
+
+    n = s->strstart < MAX_DIST(s) ? s->strstart : MAX_DIST(s);
+    if (n > s->skipped)
+        n = (uInt)s->skipped;
+    if (n >= MIN_MATCH) {
+        str = s->strstart - n;
+        s->ins_h = s->window[str];
+        UPDATE_HASH(s, s->ins_h, s->window[str+1]);
+#if MIN_MATCH != 3
+        Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
+        n -= MIN_MATCH-1;
+        do {
+            UPDATE_HASH(s, s->ins_h, s->window[str + MIN_MATCH-1]);
+#ifndef FASTEST
+            s->prev[str & s->w_mask] = s->head[s->ins_h];
+#endif
+            s->head[s->ins_h] = (Pos)str;
+            str++;
+        } while (--n);
+    }
+    s->last_stored = 0;
+    s->skip_matches = 0;
+    s->redispatch = 1;
+    s->match_length = s->prev_length = MIN_MATCH-1;
+    s->match_available = 0;
+    if (s->lookahead >= MIN_MATCH) {
+        /* else the hash is set up by fill_window() once there is input */
+        s->ins_h = s->window[s->strstart];
+        UPDATE_HASH(s, s->ins_h, s->window[s->strstart+1]);
+#if MIN_MATCH != 3
+        Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
+    }
+}
+
+/* ===========================================================================
+ * Estimate whether the next n bytes of input at strstart would benefit from
+ * matches by looking for their four-byte strings among those at every
+ * PROBE_STEP bytes of the window before them, out to the maximum match
+ * distance.  A repeat of PROBE_STEP+3 or more bytes includes one of those.
+ * This is much cheaper than the hash chain search, and random or already
+ * compressed data has essentially no such repeats.  Return true if more than
+ * one in 128 positions is seen to repeat, which is about one in sixteen
+ * positions being in a long repeat.
+ */
+local int probe_matches(s, n)
+    deflate_state *s;
+    uInt n;
+{
+    ush last[1 << PROBE_BITS];  /* one plus last sample of each hash */
+    Bytef *p;                   /* start of the window looked at */
+    unsigned hist;              /* number of bytes before strstart */
+    unsigned len;               /* number of bytes looked at */
+    unsigned i, j, h;           /* position, earlier position, hash */
+    unsigned hits;              /* number of repeated strings seen */
+
+    if (n < 4) return 0;
+    hist = s->strstart < MAX_DIST(s) ? s->strstart : MAX_DIST(s);
+    len = hist + n;
+    p = s->window + s->strstart - hist;
+    zmemzero((Bytef *)last, sizeof(last));
+    for (i = 0; i < hist; i += PROBE_STEP)
+        last[PROBE_HASH(p + i)] = (ush)(i / PROBE_STEP + 1);
+    hits = 0;
+    for (i = hist; i <= len - 4; i++) {
+        h = PROBE_HASH(p + i);
+        j = last[h];
+        if (j && (j = (j - 1) * PROBE_STEP) + MAX_DIST(s) >= i &&
+            p[j] == p[i] && p[j+1] == p[i+1] &&
+            p[j+2] == p[i+2] && p[j+3] == p[i+3])
+            hits++;
+        if (i % PROBE_STEP == 0)
+            last[h] = (ush)(i / PROBE_STEP + 1);
+    }
+    return hits > (n >> 7);
+}
+
+/* ===========================================================================
+ * Run the rolling hash over the input that has not been hashed yet, stopping
+ * after the next rsyncable point if there is one.  A point follows a byte
+ * where the hash of the last rsync_bits bytes has a fixed value, and which is
+ * at least 2^(rsync_bits-4) bytes after the previous point.  So the points
+ * depend only on the data around them, and after a change in the input the
+ * points, and the compressed data between them, are soon the same again.
+ * The input not consumed by deflate() must be provided again at next_in.
+ */
+local void rsync_scan(s)
+    deflate_state *s;
+{
+    z_streamp strm = s->strm;
+    z_const Bytef *next;
+    uInt ahead, n;
+    uLong end;
+    ulg hash, mask, min;
+
+    ahead = (uInt)(s->rsync_end - strm->total_in);
+    if (ahead > strm->avail_in) {   /* the input was not provided again */
+        s->rsync_end = strm->total_in;
+        ahead = 0;
+    }
+    next = strm->next_in + ahead;
+    n = strm->avail_in - ahead;
+    end = s->rsync_end;
+    hash = s->rsync_hash;
+    mask = ((ulg)1 << s->rsync_bits) - 1;
+    min = (ulg)1 << (s->rsync_bits - 4);
+    while (n--) {
+        hash = ((hash << 1) ^ *next++) & mask;
+        end++;
+        if (hash == (mask >> 1) && end - s->rsync_last >= min) {
+            s->rsync_last = end;
+            s->rsync_hit = 1;
+            break;
+        }
+    }
+    s->rsync_end = end;
+    s->rsync_hash = hash;
+}
+
+/* ===========================================================================
+ * Report the access point at the current block boundary to point(), which is
+ * at strstart in the window.  If full is true, the boundary follows a full
+ * flush, so no window is needed to decompress from there.
+ */
+local void point_emit(s, full)
+    deflate_state *s;
+    int full;
+{
+    z_point here;
+    uInt have;
+
+    here.in = s->strm->total_in - s->lookahead;
+    here.out = s->strm->total_out + s->pending + (s->bi_valid >> 3);
+    here.bits = s->bi_valid & 7;
+    if (here.bits) {
+        here.out++;
+        here.bits = 8 - here.bits;
+    }
+    have = full ? 0 : (s->strstart < s->w_size ? s->strstart : s->w_size);
+    here.window = have ? s->window + s->strstart - have : Z_NULL;
+    here.window_len = have;
+    s->point_next = here.in + s->point_span;
+    if (s->point(s->point_desc, &here))
+        s->point = Z_NULL;
+}
+
+#ifdef BIG_MEM
+/* ===========================================================================
+ * Use all of the input at next_in as the window, for a one-shot deflate().
+ * The input is taken at once, but is not added to the check value until
+ * big_end(), when it is known how much of it was used.  Since nothing is
+ * copied or slid, the positions in head[] and prev[] are offsets in the input,
+ * and prev[] is still indexed modulo w_size to limit matches to the last
+ * window of data.
+ */
+local void big_begin(s)
+    deflate_state *s;
+{
+    z_streamp strm = s->strm;
+
+    s->own_window = s->window;
+    s->window = (Bytef *)strm->next_in;
+    s->window_size = strm->avail_in;
+    s->lookahead = strm->avail_in;
+    strm->next_in += strm->avail_in;
+    strm->total_in += strm->avail_in;
+    strm->avail_in = 0;
+    s->insert = 0;
+    s->ins_h = s->window[0];
+    UPDATE_HASH(s, s->ins_h, s->window[1]);
+#if MIN_MATCH != 3
+    Call UPDATE_HASH() MIN_MATCH-3 more times
+#endif
+}
+
+/* ===========================================================================
+ * Go back to the allocated window when less than MIN_LOOKAHEAD bytes of the
+ * input are left, or before returning from deflate(), since the application
+ * need not keep the input that deflate() reports as used.  The history is
+ * copied into the window, along with as much of the lookahead as fits.  The
+ * rest of the lookahead is given back at next_in, for fill_window() to read
+ * again later.  The positions are moved down by a multiple of w_size, which
+ * leaves prev[] in place.
+ */
+local void big_end(s)
+    deflate_state *s;
+{
+    z_streamp strm = s->strm;
+    uInt wsize = s->w_size;
+    uInt off, hist, keep, used, n;
+    unsigned m;
+    Posf *p;
+
+    off = s->strstart < wsize ? 0 : (s->strstart - wsize) & ~s->w_mask;
+    hist = s->strstart - off;       /* at least wsize, unless at the start */
+    keep = 2 * wsize - hist;
+    if (keep > s->lookahead)
+        keep = s->lookahead;
+
+    /* update the check value with the input that was used */
+    used = s->strstart + keep;
+    if (s->wrap == 1)
+        strm->adler = adler32(strm->adler, s->window, used);
+#ifdef GZIP
+    else if (s->wrap == 2)
+        strm->adler = crc32(strm->adler, s->window, used);
+#endif
+    n = s->lookahead - keep;
+    strm->next_in -= n;
+    strm->avail_in += n;
+    strm->total_in -= n;
+    s->lookahead = keep;
+
+    /* copy the history and lookahead, and move the positions down */
+    zmemcpy(s->own_window, s->window + off, hist + keep);
+    s->window = s->own_window;
+    s->own_window = Z_NULL;
+    s->window_size = (ulg)2L*wsize;
+    if (s->high_water < hist + keep)
+        s->high_water = hist + keep;
+    if (off) {
+        s->match_start -= off;
+        s->strstart -= off;
+        s->block_start -= (long)off;
+        n = s->hash_size;
+        p = &s->head[n];
+        do {
+            m = *--p;
+            *p = (Pos)(m >= off ? m - off : NIL);
+        } while (--n);
+#ifndef FASTEST
+        n = wsize;
+        p = &s->prev[n];
+        do {
+            m = *--p;
+            *p = (Pos)(m >= off ? m - off : NIL);
+        } while (--n);
+#endif
+    }
+}
+#endif /* BIG_MEM */
+
 /* ===========================================================================
  * Copy without compression as much as possible from the input stream, return
  * the current block state.
@@ -1633,6 +2537,10 @@ local block_state deflate_fast(s, flush)
     int bflush;           /* set if current block must be flushed */
 
     for (;;) {
+        /* Stop searching for matches in an incompressible region */
+        if (s->last_stored && skip_region(s))
+            return need_more;
+
         /* Make sure that we always have enough lookahead, except
          * at the end of the input file. We need MAX_MATCH bytes
          * for the next match, plus MIN_MATCH bytes to insert the
@@ -1736,6 +2644,18 @@ local block_state deflate_slow(s, flush)
 
     /* Process the input block. */
     for (;;) {
+        /* Stop searching for matches in an incompressible region, after
+         * emitting any pending literal.  The current block is empty.
+         */
+        if (s->last_stored && skip_region(s)) {
+            if (s->match_available) {
+                Tracevv((stderr,"%c", s->window[s->strstart-1]));
+                _tr_tally_lit(s, s->window[s->strstart-1], bflush);
+                s->match_available = 0;
+            }
+            return need_more;
+        }
+
         /* Make sure that we always have enough lookahead, except
          * at the end of the input file. We need MAX_MATCH bytes
          * for the next match, plus MIN_MATCH bytes to insert the
@@ -1853,6 +2773,32 @@ local block_state deflate_slow(s, flush)
 }
 #endif /* FASTEST */
 
+/* ===========================================================================
+ * Return the number of bytes, up to max, starting at scan that are equal to c.
+ * The bytes are compared a word at a time, using zmemcpy() for the loads so
+ * that scan need not be aligned.
+ */
+local uInt run_length(scan, c, max)
+    Bytef *scan;
+    unsigned c;
+    uInt max;
+{
+    Bytef *start = scan;        /* start of run */
+    Bytef *strend = scan + max; /* end of scanned bytes */
+    ulg pat;                    /* c replicated in every byte */
+    ulg word;                   /* next word from scan */
+
+    pat = ((ulg)~0UL / 0xff) * c;
+    while ((uInt)(strend - scan) >= sizeof(ulg)) {
+        zmemcpy((Bytef *)&word, scan, sizeof(ulg));
+        if (word != pat) break;
+        scan += sizeof(ulg);
+    }
+    while (scan < strend && *scan == c)
+        scan++;
+    return (uInt)(scan - start);
+}
+
 /* ===========================================================================
  * For Z_RLE, simply look for runs of bytes, generate matches only of distance
  * one.  Do not maintain a hash table.  (It will be regenerated if this run of
@@ -1864,7 +2810,7 @@ local block_state deflate_rle(s, flush)
 {
     int bflush;             /* set if current block must be flushed */
     uInt prev;              /* byte at distance one to match */
-    Bytef *scan, *strend;   /* scan goes up to strend for length of run */
+    Bytef *scan;            /* start of possible run */
 
     for (;;) {
         /* Make sure that we always have enough lookahead, except
@@ -1882,21 +2828,11 @@ local block_state deflate_rle(s, flush)
         /* See how many times the previous byte repeats */
         s->match_length = 0;
         if (s->lookahead >= MIN_MATCH && s->strstart > 0) {
-            scan = s->window + s->strstart - 1;
-            prev = *scan;
-            if (prev == *++scan && prev == *++scan && prev == *++scan) {
-                strend = s->window + s->strstart + MAX_MATCH;
-                do {
-                } while (prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         scan < strend);
-                s->match_length = MAX_MATCH - (int)(strend - scan);
-                if (s->match_length > s->lookahead)
-                    s->match_length = s->lookahead;
-            }
-            Assert(scan <= s->window+(uInt)(s->window_size-1), "wild scan");
+            scan = s->window + s->strstart;
+            prev = scan[-1];
+            if (prev == scan[0] && prev == scan[1] && prev == scan[2])
+                s->match_length = run_length(scan, prev,
+                    s->lookahead < MAX_MATCH ? s->lookahead : MAX_MATCH);
         }
 
         /* Emit match if have run of MIN_MATCH or longer, else emit literal */
@@ -1930,6 +2866,10 @@ local block_state deflate_rle(s, flush)
 /* ===========================================================================
  * For Z_HUFFMAN_ONLY, do not look for matches.  Do not maintain a hash table.
  * (It will be regenerated if this run of deflate switches away from Huffman.)
+ * This is also used for incompressible regions of the other strategies, see
+ * skip_region(), in which case the input is probed for repeats before it is
+ * taken as literals, and leave_region() is called when there are some, or
+ * when a block of literals did better than a stored block.
  */
 local block_state deflate_huff(s, flush)
     deflate_state *s;
@@ -1948,13 +2888,35 @@ local block_state deflate_huff(s, flush)
             }
         }
 
-        /* Output a literal byte */
+        /* Output as many literal bytes as fit in the current block, but in an
+           incompressible region, end the block instead before any repeats */
         s->match_length = 0;
-        Tracevv((stderr,"%c", s->window[s->strstart]));
-        _tr_tally_lit (s, s->window[s->strstart], bflush);
-        s->lookahead--;
-        s->strstart++;
-        if (bflush) FLUSH_BLOCK(s, 0);
+        {
+            uInt n = s->lit_bufsize - 1 - s->last_lit;
+            if (n > s->lookahead) n = s->lookahead;
+            if (s->skip_matches) {
+                if (n > PROBE_LEN) n = PROBE_LEN;
+                if (probe_matches(s, n)) {
+                    if (s->last_lit)
+                        FLUSH_BLOCK_ONLY(s, 0);
+                    leave_region(s);
+                    return need_more;
+                }
+            }
+            bflush = _tr_tally_lits(s, s->window + s->strstart, n);
+            s->lookahead -= n;
+            s->strstart += n;
+            s->skipped += n;
+        }
+        if (bflush) {
+            FLUSH_BLOCK_ONLY(s, 0);
+            if (s->skip_matches && s->last_stored == 0) {
+                leave_region(s);
+                return need_more;
+            }
+            if (s->strm->avail_out == 0)
+                return need_more;
+        }
     }
     s->insert = 0;
     if (flush == Z_FINISH) {
@@ -36,8 +36,12 @@
 #define L_CODES (LITERALS+1+LENGTH_CODES)
 /* number of Literal or Length codes, including the END_BLOCK code */
 
-#define D_CODES   30
-/* number of distance codes */
+#ifdef DEFLATE64
+#  define D_CODES 32
+#else
+#  define D_CODES 30
+#endif
+/* number of distance codes (two more for the 64K window of deflate64) */
 
 #define BL_CODES  19
 /* number of codes used to transfer the bit lengths */
@@ -86,12 +90,18 @@ typedef struct tree_desc_s {
     static_tree_desc *stat_desc; /* the corresponding static tree */
 } FAR tree_desc;
 
+#if defined(DEFLATE64) || defined(BIG_MEM)
+typedef uInt Pos;
+#else
 typedef ush Pos;
+#endif
 typedef Pos FAR Posf;
 typedef unsigned IPos;
 
 /* A Pos is an index in the character window. We use short instead of int to
- * save space in the various tables. IPos is used only for parameter passing.
+ * save space in the various tables, except when compiled for deflate64, where
+ * the window is 128K, or with BIG_MEM, where the window can be the whole
+ * input. IPos is used only for parameter passing.
  */
 
 typedef struct internal_state {
@@ -104,7 +114,7 @@ typedef struct internal_state {
     int   wrap;          /* bit 0 true for zlib, bit 1 true for gzip */
     gz_headerp  gzhead;  /* gzip header information to write */
     uInt   gzindex;      /* where in extra, name, or comment */
-    Byte  method;        /* can only be DEFLATED */
+    Byte  method;        /* Z_DEFLATED, or Z_DEFLATED64 with DEFLATE64 */
     int   last_flush;    /* value of flush param for previous deflate call */
 
                 /* used by deflate.c: */
@@ -120,7 +130,8 @@ typedef struct internal_state {
      * wSize-MAX_MATCH bytes, but this ensures that IO is always
      * performed with a length multiple of the block size. Also, it limits
      * the window size to 64K, which is quite useful on MSDOS.
-     * To do: use the user input buffer as sliding window.
+     * With BIG_MEM, a one-shot deflate() uses the user input buffer as the
+     * window instead (see own_window below).
      */
 
     ulg window_size;
@@ -248,6 +259,22 @@ typedef struct internal_state {
     ulg static_len;     /* bit length of current block with static trees */
     uInt matches;       /* number of string matches in current block */
     uInt insert;        /* bytes at end of window left to insert */
+    ulg last_stored;    /* length of last block if it was stored, else 0 */
+    int skip_matches;   /* true while in an incompressible region */
+    ulg skipped;        /* bytes not hashed since the region started */
+    int redispatch;     /* set when the compression function must change */
+
+    int rsync_bits;     /* rsyncable points every 2^rsync_bits bytes, or 0 */
+    uInt rsync_hash;    /* rolling hash of the input up to rsync_end */
+    uLong rsync_end;    /* total_in at the end of the input hashed so far */
+    uLong rsync_last;   /* total_in at the last rsyncable point */
+    int rsync_hit;      /* true if rsync_end is an rsyncable point */
+
+    point_func point;   /* access point callback, or Z_NULL if none */
+    void FAR *point_desc;   /* first argument for point() */
+    uLong point_span;   /* minimum uncompressed bytes between access points */
+    uLong point_next;   /* uncompressed offset due for the next access point */
+    int point_full;     /* true to do a full flush at each access point */
 
 #ifdef DEBUG
     ulg compressed_len; /* total bit length of compressed file mod 2^32 */
@@ -270,8 +297,30 @@ typedef struct internal_state {
      * updated to the new high water mark.
      */
 
+#ifdef BIG_MEM
+    Bytef *own_window;
+    /* The allocated window while window is the input of a one-shot deflate(),
+     * else Z_NULL.  Then window_size is the input size, and nothing slides.
+     */
+#endif
+
 } FAR deflate_state;
 
+/* A dictionary prepared by deflatePrepareDictionary(): the tail of the
+ * dictionary as it would be in the window after deflateSetDictionary(),
+ * with the hash chains built over it. This is only read after it is built,
+ * so it can be used by any number of streams at once.
+ */
+typedef struct z_dict_s {
+    uInt  w_bits;       /* window size this was prepared for */
+    uInt  hash_bits;    /* hash size this was prepared for */
+    uInt  length;       /* number of dictionary bytes, at most w_size */
+    uLong adler;        /* adler32 of the whole dictionary */
+    Bytef *window;      /* the last length bytes of the dictionary */
+    Posf  *head;        /* hash_size heads of the hash chains */
+    Posf  *prev;        /* length links of the hash chains */
+} FAR z_dict;
+
 /* Output a byte on the stream.
  * IN assertion: there is enough room in pending_buf.
  */
@@ -295,6 +344,8 @@ typedef struct internal_state {
         /* in trees.c */
 void ZLIB_INTERNAL _tr_init OF((deflate_state *s));
 int ZLIB_INTERNAL _tr_tally OF((deflate_state *s, unsigned dist, unsigned lc));
+int ZLIB_INTERNAL _tr_tally_lits OF((deflate_state *s, const uchf *buf,
+                        unsigned len));
 void ZLIB_INTERNAL _tr_flush_block OF((deflate_state *s, charf *buf,
                         ulg stored_len, int last));
 void ZLIB_INTERNAL _tr_flush_bits OF((deflate_state *s));
@@ -309,10 +360,21 @@ void ZLIB_INTERNAL _tr_stored_block OF((deflate_state *s, charf *buf,
  * used.
  */
 
+#ifdef DEFLATE64
+#  define l_code(s, len) ((len) == MAX_MATCH-MIN_MATCH && \
+                          (s)->method == Z_DEFLATED64 ? \
+                          LENGTH_CODES-2 : _length_code[len])
+#else
+#  define l_code(s, len) (_length_code[len])
+#endif
+/* Mapping from a match length - MIN_MATCH to a length code. For deflate64,
+ * length code 285 has 16 extra bits, so the length 258 uses code 284.
+ */
+
 #ifndef DEBUG
 /* Inline versions of _tr_tally for speed: */
 
-#if defined(GEN_TREES_H) || !defined(STDC)
+#if defined(GEN_TREES_H) || !defined(STDC) || defined(DEFLATE64)
   extern uch ZLIB_INTERNAL _length_code[];
   extern uch ZLIB_INTERNAL _dist_code[];
 #else
@@ -333,7 +395,7 @@ void ZLIB_INTERNAL _tr_stored_block OF((deflate_state *s, charf *buf,
     s->d_buf[s->last_lit] = dist; \
     s->l_buf[s->last_lit++] = len; \
     dist--; \
-    s->dyn_ltree[_length_code[len]+LITERALS+1].Freq++; \
+    s->dyn_ltree[l_code(s, len)+LITERALS+1].Freq++; \
     s->dyn_dtree[d_code(dist)].Freq++; \
     flush = (s->last_lit == s->lit_bufsize-1); \
   }
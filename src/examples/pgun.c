@@ -0,0 +1,596 @@
+/* pgun.c -- decompress a single gzip member using many threads
+ * Copyright (C) 2026 The Android Open Source Project
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* pgun decompresses gzip data from stdin to stdout, using multiple threads to
+   decode a single deflate stream, which would otherwise have to be decoded
+   serially.  It illustrates the use of Z_BLOCK, inflatePrime(), and
+   inflateSetDictionary() to start decoding in the middle of a deflate stream
+   without knowing the 32K bytes of uncompressed data that precede it.
+
+   The compressed data is divided into chunks of CHUNK bytes.  A thread is
+   started for each chunk, up to the number of threads requested, with more
+   started as the earlier chunks are finished.  Each thread looks through its
+   chunk, bit by bit, for something that looks like the start of a dynamic
+   deflate block header.  The check is cheap and strict -- a non-last dynamic
+   block with valid counts and a complete code for the code lengths.  When a
+   candidate is found, the thread starts decoding there with inflatePrime()
+   providing the bits of the first partial byte.  If decoding fails, the
+   candidate was not a block, and the search continues after it.
+
+   The data before the candidate block is not known, so matches that reach
+   back past the start of the chunk can't be copied.  Instead the chunk is
+   decoded three times at once, in lockstep, each time with a different 32K
+   dictionary set with inflateSetDictionary().  The three dictionaries are the
+   low bytes of the dictionary positions, the high bytes of the positions, and
+   the low bytes exclusive-or'ed with 0x55.  Decoding does not depend on the
+   dictionary contents, so the three decodings consume the same input and
+   write the same amount of output.  An output byte that differs between the
+   first and third decodings was copied from the dictionary, and the first and
+   second decodings give its position in the dictionary.  These positions are
+   saved as markers, to be replaced with the actual bytes once the preceding
+   chunk has been decoded.  Once 32K bytes of output have gone by with no
+   markers, no more can appear, and the thread continues with just one
+   decoding.
+
+   Each thread stops decoding at the first block boundary at or after the
+   start of the next chunk, which is found with Z_BLOCK.  That should be the
+   same block that the next chunk's thread started on.  The main thread joins
+   the threads in order, replaces the markers, checks that each chunk starts
+   where the previous one stopped, and writes the output.  If a chunk's start
+   does not match, because no block was found in it or because a candidate
+   that was not really a block happened to decode, then the chunk is decoded
+   again by the main thread, starting where the previous chunk stopped and
+   with the now known dictionary.  The same is done if the chunk holds no
+   dynamic blocks at all, e.g. only stored blocks, so the result is always
+   correct, if not always parallel.
+
+   The CRC-32 of each chunk's output after its last marker is computed by its
+   thread, and the main thread combines those with crc32_combine() to check
+   against the gzip trailer.  Concatenated gzip members are decompressed one
+   after the other, each in parallel.
+
+   pgun uses POSIX threads, and reads all of its input into memory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "zlib.h"
+
+#define local static
+
+#define CHUNK (1UL << 22)       /* compressed bytes per thread */
+#define WINSIZE 32768U          /* sliding window size */
+#define PIECE 65536U            /* output to decode at a time */
+
+/* a marker for an output byte copied from the unknown dictionary */
+struct mark {
+    size_t pos;                 /* position in the chunk's output */
+    unsigned idx;               /* position in the dictionary */
+};
+
+/* a chunk of the compressed data and its decompression */
+struct chunk {
+    /* set before the thread starts */
+    const unsigned char *in;    /* raw deflate data */
+    size_t len;                 /* length of raw deflate data */
+    size_t from;                /* bit to start looking for a block */
+    size_t limit;               /* stop at the first block boundary here */
+    int first;                  /* true if from is the start of the stream */
+    pthread_t thread;           /* thread decoding this chunk */
+    /* set by decode() */
+    int ok;                     /* true if the chunk was decoded */
+    size_t start;               /* bit where decoding started */
+    size_t stop;                /* bit where decoding stopped */
+    size_t end;                 /* byte after the end of the stream */
+    int last;                   /* true if the stream ended in this chunk */
+    unsigned char *out;         /* decompressed data */
+    size_t have;                /* bytes of decompressed data */
+    size_t size;                /* allocated size of out */
+    struct mark *mark;          /* markers in out */
+    size_t marks;               /* number of markers */
+    size_t room;                /* allocated markers */
+    size_t clean;               /* no markers in out[clean..have-1] */
+    unsigned long crc;          /* CRC-32 of out[clean..have-1] */
+};
+
+/* dictionaries for speculative decoding: low position, high position, and
+   low position exclusive-or 0x55 */
+local unsigned char spec[3][WINSIZE];
+
+/* get n bits at bit position p of in[0..len-1], zeros past the end */
+local unsigned getbits(const unsigned char *in, size_t len, size_t p, int n)
+{
+    unsigned long val = 0;
+    size_t k = p >> 3;
+    int i;
+
+    for (i = 0; i < 4 && k + i < len; i++)
+        val |= (unsigned long)in[k + i] << (i << 3);
+    return (unsigned)(val >> (p & 7)) & ((1U << n) - 1);
+}
+
+/* return true if bit p of in[0..len-1] looks like the start of a non-last
+   dynamic block: the literal/length and distance counts must be in range,
+   and the code length code must be complete, as inflate() requires */
+local int candidate(const unsigned char *in, size_t len, size_t p)
+{
+    unsigned ncode, n, bits, left;
+
+    if (getbits(in, len, p, 3) != 4)            /* BFINAL 0, BTYPE 2 */
+        return 0;
+    if (getbits(in, len, p + 3, 5) > 29 || getbits(in, len, p + 8, 5) > 29)
+        return 0;
+    ncode = getbits(in, len, p + 13, 4) + 4;
+    left = 1U << 7;
+    for (n = 0; n < ncode; n++) {
+        bits = getbits(in, len, p + 17 + 3 * n, 3);
+        if (bits) {
+            if ((1U << (7 - bits)) > left)
+                return 0;
+            left -= 1U << (7 - bits);
+        }
+    }
+    return left == 0;
+}
+
+/* set up s for raw inflate starting at bit start of in, with the dictionary
+   dict[0..dlen-1] -- return zlib's return code */
+local int begin(z_stream *s, const unsigned char *in, size_t start,
+                const unsigned char *dict, unsigned dlen)
+{
+    int ret;
+
+    s->zalloc = Z_NULL;
+    s->zfree = Z_NULL;
+    s->opaque = Z_NULL;
+    s->next_in = Z_NULL;
+    s->avail_in = 0;
+    ret = inflateInit2(s, -15);
+    if (ret != Z_OK)
+        return ret;
+    if (start & 7)
+        inflatePrime(s, 8 - (int)(start & 7), in[start >> 3] >> (start & 7));
+    if (dlen)
+        inflateSetDictionary(s, dict, dlen);
+    s->next_in = (z_const Bytef *)in + ((start + 7) >> 3);
+    return Z_OK;
+}
+
+/* make room for PIECE more bytes of output in c */
+local int grow(struct chunk *c)
+{
+    size_t size;
+    unsigned char *out;
+
+    if (c->size - c->have >= PIECE)
+        return 0;
+    size = c->size ? c->size << 1 : PIECE << 4;
+    while (size - c->have < PIECE)
+        size <<= 1;
+    out = realloc(c->out, size);
+    if (out == NULL)
+        return -2;
+    c->out = out;
+    c->size = size;
+    return 0;
+}
+
+/* add a marker for dictionary position idx at out[pos] */
+local int marker(struct chunk *c, size_t pos, unsigned idx)
+{
+    struct mark *mark;
+
+    if (c->marks == c->room) {
+        c->room = c->room ? c->room << 1 : 1024;
+        mark = realloc(c->mark, c->room * sizeof(struct mark));
+        if (mark == NULL)
+            return -2;
+        c->mark = mark;
+    }
+    c->mark[c->marks].pos = pos;
+    c->mark[c->marks].idx = idx;
+    c->marks++;
+    return 0;
+}
+
+/* Decode c->in starting at bit start into c, stopping at the first block
+   boundary at or after bit c->limit, or at the end of the deflate stream.  If
+   win is NULL, then the 32K bytes before start are not known, and markers are
+   made for them.  Otherwise win[0..wlen-1] are the bytes before start.  Return
+   0 on success, -1 if the data is invalid or runs out, or -2 if out of
+   memory. */
+local int decode(struct chunk *c, size_t start, const unsigned char *win,
+                 unsigned wlen)
+{
+    int ret, err, k, n;
+    unsigned got, i;
+    size_t left, pos;
+    z_stream strm[3];
+    unsigned char *scratch;
+
+    c->ok = 0;
+    c->start = start;
+    c->last = 0;
+    c->have = 0;
+    c->marks = 0;
+    c->clean = 0;
+    if ((start + 7) >> 3 > c->len)
+        return -1;
+
+    /* set up one decoding, or three if speculating */
+    n = win == NULL ? 3 : 1;
+    scratch = NULL;
+    if (n == 3) {
+        scratch = malloc(PIECE << 1);
+        if (scratch == NULL)
+            return -2;
+    }
+    for (k = 0; k < n; k++)
+        if (begin(strm + k, c->in, start, win == NULL ? spec[k] : win,
+                  win == NULL ? WINSIZE : wlen) != Z_OK) {
+            while (k)
+                inflateEnd(strm + --k);
+            free(scratch);
+            return -2;
+        }
+
+    /* decode a block or a piece at a time until we get to the limit */
+    for (;;) {
+        ret = grow(c);
+        if (ret)
+            break;
+        left = c->len - (size_t)(strm[0].next_in - c->in);
+        for (k = 0; k < n; k++) {
+            strm[k].avail_in = left > (1U << 30) ? 1U << 30 : (unsigned)left;
+            strm[k].next_out = k ? scratch + (k - 1) * PIECE :
+                                   c->out + c->have;
+            strm[k].avail_out = PIECE;
+            ret = inflate(strm + k, Z_BLOCK);
+            if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR ||
+                ret == Z_MEM_ERROR)
+                break;
+        }
+        if (k < n) {
+            ret = ret == Z_MEM_ERROR ? -2 : -1;
+            break;
+        }
+        got = PIECE - strm[0].avail_out;
+
+        /* mark the bytes that came from the unknown dictionary */
+        if (n == 3) {
+            err = 0;
+            for (i = 0; i < got; i++)
+                if (c->out[c->have + i] != scratch[PIECE + i]) {
+                    err = marker(c, c->have + i, c->out[c->have + i] |
+                                 ((unsigned)scratch[i] << 8));
+                    if (err)
+                        break;
+                    c->clean = c->have + i + 1;
+                }
+            if (err) {
+                ret = err;
+                break;
+            }
+            if (c->have + got - c->clean >= WINSIZE) {
+                inflateEnd(strm + 2);
+                inflateEnd(strm + 1);
+                n = 1;
+            }
+        }
+        c->have += got;
+
+        /* check for the end of the stream or of the chunk */
+        if (ret == Z_STREAM_END) {
+            c->last = 1;
+            c->end = (size_t)(strm[0].next_in - c->in);
+            c->stop = c->end << 3;
+            ret = 0;
+            break;
+        }
+        if ((strm[0].data_type & (128 | 64)) == 128) {
+            /* a block boundary -- after the last block, keep going to get
+               Z_STREAM_END and the end of the stream */
+            pos = ((size_t)(strm[0].next_in - c->in) << 3) -
+                  (strm[0].data_type & 63);
+            if (pos >= c->limit) {
+                c->stop = pos;
+                ret = 0;
+                break;
+            }
+        }
+        if (got == 0 && left == 0) {
+            ret = -1;                       /* ran out of input */
+            break;
+        }
+    }
+    for (k = 0; k < n; k++)
+        inflateEnd(strm + k);
+    free(scratch);
+    if (ret)
+        return ret;
+    c->crc = crc32(crc32(0L, Z_NULL, 0), c->out + c->clean,
+                   c->have - c->clean);
+    c->ok = 1;
+    return 0;
+}
+
+/* find where to start decoding the chunk c and decode it */
+local void *work(void *arg)
+{
+    struct chunk *c = arg;
+    size_t p;
+
+    if (c->first) {
+        decode(c, c->from, (const unsigned char *)"", 0);
+        return NULL;
+    }
+    for (p = c->from; p < c->limit && p < c->len << 3; p++)
+        if (candidate(c->in, c->len, p) && decode(c, p, NULL, 0) != -1)
+            break;
+    return NULL;
+}
+
+/* exit with an error message */
+local void bail(const char *why)
+{
+    fprintf(stderr, "pgun error: %s\n", why);
+    exit(1);
+}
+
+/* output state for putting the decoded chunks together in order */
+struct put {
+    FILE *out;                  /* where to write the output */
+    unsigned long crc;          /* CRC-32 of the output so far */
+    unsigned long total;        /* length of the output so far */
+    unsigned char *win;         /* the last 32K of the output */
+    unsigned wlen;              /* bytes in win */
+};
+
+/* replace the markers in c with the bytes they refer to, update the check
+   value, write the output, and update the dictionary for the next chunk --
+   free the output and markers in c */
+local void emit(struct chunk *c, struct put *put)
+{
+    size_t i;
+    unsigned k;
+
+    /* replace the markers with the bytes from the dictionary */
+    for (i = 0; i < c->marks; i++) {
+        k = c->mark[i].idx;
+        if (k < WINSIZE - put->wlen)
+            bail("invalid distance too far back");
+        c->out[c->mark[i].pos] = put->win[k - (WINSIZE - put->wlen)];
+    }
+
+    /* check and write the output */
+    put->crc = crc32_combine(put->crc, crc32(crc32(0L, Z_NULL, 0), c->out,
+                                             c->clean), (z_off_t)c->clean);
+    put->crc = crc32_combine(put->crc, c->crc, (z_off_t)(c->have - c->clean));
+    put->total += (unsigned long)c->have;
+    if (fwrite(c->out, 1, c->have, put->out) != c->have)
+        bail("write error");
+
+    /* update the dictionary for the next chunk */
+    if (c->have >= WINSIZE) {
+        memcpy(put->win, c->out + c->have - WINSIZE, WINSIZE);
+        put->wlen = WINSIZE;
+    }
+    else {
+        k = WINSIZE - (unsigned)c->have;
+        if (k > put->wlen)
+            k = put->wlen;
+        memmove(put->win, put->win + put->wlen - k, k);
+        memcpy(put->win + k, c->out, c->have);
+        put->wlen = k + (unsigned)c->have;
+    }
+    free(c->out);
+    free(c->mark);
+    c->out = NULL;
+    c->size = 0;
+    c->mark = NULL;
+    c->room = 0;
+}
+
+/* decode c starting at bit pos with the dictionary in put, exiting on error */
+local void redo(struct chunk *c, size_t pos, struct put *put)
+{
+    int ret;
+
+    ret = decode(c, pos, put->win, put->wlen);
+    if (ret == -2)
+        bail("out of memory");
+    if (ret)
+        bail("invalid or truncated deflate data");
+}
+
+/* decompress the gzip member at the start of in[0..len-1] to out, using up to
+   threads threads, and return the number of bytes in the member */
+local size_t member(const unsigned char *in, size_t len, int threads,
+                    FILE *out)
+{
+    size_t skip, n, i, started, pos, end;
+    struct chunk *chunk, *c, bridge;
+    struct put put;
+    z_stream strm;
+    unsigned char dummy;
+
+    /* use inflate() to skip over the gzip header */
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.next_in = Z_NULL;
+    strm.avail_in = 0;
+    if (inflateInit2(&strm, 31) != Z_OK)
+        bail("out of memory");
+    strm.next_in = (z_const Bytef *)in;
+    strm.avail_in = len > 65536U ? 65536U : (unsigned)len;
+    strm.next_out = &dummy;
+    strm.avail_out = 1;
+    if (inflate(&strm, Z_BLOCK) != Z_OK || !(strm.data_type & 128) ||
+        strm.total_out)
+        bail("invalid or truncated gzip header");
+    skip = (size_t)(strm.next_in - in);
+    inflateEnd(&strm);
+    in += skip;
+    len -= skip;
+
+    /* divide the raw deflate data into chunks */
+    n = len / CHUNK;
+    if (n == 0)
+        n = 1;
+    chunk = calloc(n, sizeof(struct chunk));
+    put.win = malloc(WINSIZE);
+    if (chunk == NULL || put.win == NULL)
+        bail("out of memory");
+    for (i = 0; i < n; i++) {
+        c = chunk + i;
+        c->in = in;
+        c->len = len;
+        c->from = (i * CHUNK) << 3;
+        c->limit = i + 1 < n ? ((i + 1) * CHUNK) << 3 : (size_t)0 - 1;
+        c->first = i == 0;
+    }
+    memset(&bridge, 0, sizeof(bridge));
+    bridge.in = in;
+    bridge.len = len;
+
+    /* decode the chunks in parallel, and put them together in order */
+    put.out = out;
+    put.crc = crc32(0L, Z_NULL, 0);
+    put.total = 0;
+    put.wlen = 0;
+    pos = 0;
+    end = 0;
+    started = 0;
+    for (i = 0; i < n; i++) {
+        while (started < n && started < i + (size_t)threads) {
+            if (pthread_create(&chunk[started].thread, NULL, work,
+                               chunk + started))
+                bail("could not create thread");
+            started++;
+        }
+        c = chunk + i;
+        pthread_join(c->thread, NULL);
+
+        /* if the chunk started after where the last one stopped, e.g. after
+           a stored or fixed block that couldn't be found, then decode up to
+           its start with the known dictionary */
+        if (c->ok && pos < c->start && pos < c->limit) {
+            bridge.limit = c->start;
+            redo(&bridge, pos, &put);
+            emit(&bridge, &put);
+            pos = bridge.stop;
+            if (bridge.last) {
+                end = bridge.end;
+                break;
+            }
+        }
+
+        /* if the chunk still doesn't start where the last one stopped, then
+           decode it again from there, unless the last one went past it */
+        if (pos >= c->limit) {
+            free(c->out);
+            free(c->mark);
+            continue;
+        }
+        if (!c->ok || c->start != pos)
+            redo(c, pos, &put);
+        emit(c, &put);
+        pos = c->stop;
+        if (c->last) {
+            end = c->end;
+            break;
+        }
+    }
+    if (i == n)
+        bail("invalid or truncated deflate data");
+
+    /* wait for any threads working past the end of the stream */
+    free(c->out);
+    free(c->mark);
+    while (++i < started) {
+        pthread_join(chunk[i].thread, NULL);
+        free(chunk[i].out);
+        free(chunk[i].mark);
+    }
+    free(put.win);
+    free(chunk);
+
+    /* check the gzip trailer */
+    if (len - end < 8)
+        bail("truncated gzip trailer");
+    in += end;
+    if (put.crc != (in[0] | ((unsigned long)in[1] << 8) |
+                    ((unsigned long)in[2] << 16) |
+                    ((unsigned long)in[3] << 24)))
+        bail("crc mismatch");
+    if ((put.total & 0xffffffffUL) != (in[4] | ((unsigned long)in[5] << 8) |
+                                       ((unsigned long)in[6] << 16) |
+                                       ((unsigned long)in[7] << 24)))
+        bail("length mismatch");
+    return skip + end + 8;
+}
+
+/* decompress gzip data from stdin to stdout, using the number of threads
+   given with -t, or the number of processors */
+int main(int argc, char **argv)
+{
+    int threads;
+    size_t len, size, got, used;
+    unsigned char *in, *more;
+    unsigned n;
+
+    /* get the number of threads */
+    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (argc == 3 && strcmp(argv[1], "-t") == 0)
+        threads = atoi(argv[2]);
+    else if (argc != 1) {
+        fputs("usage: pgun [-t threads] < in.gz > out\n", stderr);
+        return 1;
+    }
+    if (threads < 1)
+        threads = 1;
+
+    /* make the dictionaries for speculative decoding */
+    for (n = 0; n < WINSIZE; n++) {
+        spec[0][n] = (unsigned char)n;
+        spec[1][n] = (unsigned char)(n >> 8);
+        spec[2][n] = (unsigned char)(n ^ 0x55);
+    }
+
+    /* read all of the input */
+    size = 1UL << 20;
+    len = 0;
+    in = malloc(size);
+    if (in == NULL)
+        bail("out of memory");
+    while ((got = fread(in + len, 1, size - len, stdin)) > 0) {
+        len += got;
+        if (len == size) {
+            size <<= 1;
+            more = realloc(in, size);
+            if (more == NULL)
+                bail("out of memory");
+            in = more;
+        }
+    }
+    if (ferror(stdin))
+        bail("read error");
+    if (len == 0)
+        bail("no input");
+
+    /* decompress each gzip member */
+    used = 0;
+    do {
+        used += member(in + used, len - used, threads, stdout);
+    } while (used < len);
+    free(in);
+    if (fflush(stdout))
+        bail("write error");
+    return 0;
+}
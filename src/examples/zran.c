@@ -50,6 +50,13 @@
    more memory per access point, and also cannot be saved to file due to the
    use of pointers in the state.  The approach here allows for storage of the
    index in a file.
+
+   When the compressed data is being made anyway, the same access points can
+   be had without decompressing it again, using deflateAccessPoints().  Each
+   point reported by deflate() has the offsets, the bits, and the window saved
+   by build_index() here, so the index entries can be made directly from them.
+   With full true, deflate() instead flushes at each point, so that no window
+   needs to be saved.
  */
 
 #include <stdio.h>
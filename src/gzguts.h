@@ -135,6 +135,17 @@
     ZEXTERN z_off64_t ZEXPORT gzoffset64 OF((gzFile));
 #endif
 
+/* file position functions, also used to find blocked gzip members */
+#if defined(_WIN32) && !defined(__BORLANDC__)
+#  define LSEEK _lseeki64
+#else
+#if defined(_LARGEFILE64_SOURCE) && _LFS64_LARGEFILE-0
+#  define LSEEK lseek64
+#else
+#  define LSEEK lseek
+#endif
+#endif
+
 /* default memLevel */
 #if MAX_MEM_LEVEL >= 8
 #  define DEF_MEM_LEVEL 8
@@ -152,6 +163,12 @@
 #define GZ_WRITE 31153
 #define GZ_APPEND 1     /* mode set to GZ_WRITE after the file is opened */
 
+/* blocked gzip files, as written by BGZF: each member holds at most BGZF_BLOCK
+   uncompressed bytes, so that it fits in BGZF_MAX bytes compressed, and has an
+   extra subfield "BC" with the member size less one */
+#define BGZF_BLOCK 65280U
+#define BGZF_MAX 65536U
+
 /* values for gz_state how */
 #define LOOK 0      /* look for a gzip header */
 #define COPY 1      /* copy input directly */
@@ -181,6 +198,19 @@ typedef struct {
         /* just for writing */
     int level;              /* compression level */
     int strategy;           /* compression strategy */
+    int rsyncable;          /* true to write rsyncable output */
+    unsigned bin;           /* uncompressed bytes in the current member */
+    gz_header bhead;        /* header for blocked members */
+    unsigned char bextra[6];    /* extra field with the member size */
+        /* blocked gzip files -- members known so far, where entry i is the
+           start of member i and entry bn is the end of the known members */
+    int blocked;            /* 0 if not blocked, 1 if blocked, 2 if blocked
+                               with an index, -1 if not known yet */
+    z_off64_t *boff;        /* member offsets in the file, from start */
+    z_off64_t *bpos;        /* member offsets in the uncompressed data */
+    unsigned bn;            /* number of members known */
+    unsigned bmax;          /* allocated entries */
+    int bdone;              /* true if all of the members are known */
         /* seek request */
     z_off64_t skip;         /* amount to skip (already rewound if backwards) */
     int seek;               /* true if seek request pending */
@@ -194,6 +224,8 @@ typedef gz_state FAR *gz_statep;
 
 /* shared functions */
 void ZLIB_INTERNAL gz_error OF((gz_statep, int, const char *));
+int ZLIB_INTERNAL gz_grow OF((gz_statep));
+int ZLIB_INTERNAL gz_jump OF((gz_statep, z_off64_t));
 #if defined UNDER_CE
 char ZLIB_INTERNAL *gz_strwinerror OF((DWORD error));
 #endif
@@ -5,16 +5,6 @@
 
 #include "gzguts.h"
 
-#if defined(_WIN32) && !defined(__BORLANDC__)
-#  define LSEEK _lseeki64
-#else
-#if defined(_LARGEFILE64_SOURCE) && _LFS64_LARGEFILE-0
-#  define LSEEK lseek64
-#else
-#  define LSEEK lseek
-#endif
-#endif
-
 /* Local functions */
 local void gz_reset OF((gz_statep));
 local gzFile gz_open OF((const void *, int, const char *));
@@ -119,6 +109,8 @@ local gzFile gz_open(path, fd, mode)
     state->mode = GZ_NONE;
     state->level = Z_DEFAULT_COMPRESSION;
     state->strategy = Z_DEFAULT_STRATEGY;
+    state->rsyncable = 0;
+    state->blocked = 0;
     state->direct = 0;
     while (*mode) {
         if (*mode >= '0' && *mode <= '9')
@@ -163,6 +155,16 @@ local gzFile gz_open(path, fd, mode)
             case 'F':
                 state->strategy = Z_FIXED;
                 break;
+            case 'S':
+                state->rsyncable = 1;
+                break;
+            case 'B':
+                if (state->blocked == 0)
+                    state->blocked = 1;
+                break;
+            case 'I':
+                state->blocked = 2;
+                break;
             case 'T':
                 state->direct = 1;
                 break;
@@ -185,8 +187,20 @@ local gzFile gz_open(path, fd, mode)
             return NULL;
         }
         state->direct = 1;      /* for empty file */
+        state->blocked = -1;    /* see if it is blocked when seeking */
     }
 
+    /* members are written independently, and transparent writing has none */
+    if (state->blocked > 0)
+        state->rsyncable = 0;
+    if (state->direct && state->mode != GZ_READ)
+        state->blocked = 0;
+    state->boff = NULL;
+    state->bpos = NULL;
+    state->bn = state->bmax = 0;
+    state->bdone = 0;
+    state->bin = 0;
+
     /* save the path name for error messages */
 #ifdef _WIN32
     if (fd == -2) {
@@ -358,6 +372,34 @@ int ZEXPORT gzrewind(file)
     return 0;
 }
 
+/* Make room for entry bn + 1 of the member list.  Return -1 on error. */
+int ZLIB_INTERNAL gz_grow(state)
+    gz_statep state;
+{
+    unsigned max;
+    z_off64_t *list;
+
+    if (state->bn + 2 <= state->bmax)
+        return 0;
+    max = state->bmax ? state->bmax : 64;
+    while (max < state->bn + 2)
+        max <<= 1;
+    list = (z_off64_t *)realloc(state->boff, max * sizeof(z_off64_t));
+    if (list == NULL) {
+        gz_error(state, Z_MEM_ERROR, "out of memory");
+        return -1;
+    }
+    state->boff = list;
+    list = (z_off64_t *)realloc(state->bpos, max * sizeof(z_off64_t));
+    if (list == NULL) {
+        gz_error(state, Z_MEM_ERROR, "out of memory");
+        return -1;
+    }
+    state->bpos = list;
+    state->bmax = max;
+    return 0;
+}
+
 /* -- see zlib.h -- */
 z_off64_t ZEXPORT gzseek64(file, offset, whence)
     gzFile file;
@@ -406,6 +448,15 @@ z_off64_t ZEXPORT gzseek64(file, offset, whence)
         return state->x.pos;
     }
 
+    /* in a blocked gzip file, go to the start of the member with the offset */
+    if (state->mode == GZ_READ && state->blocked && state->x.pos + offset >= 0) {
+        ret = gz_jump(state, state->x.pos + offset);
+        if (ret == -1)
+            return -1;
+        if (ret == 0)
+            return state->x.pos + (state->seek ? state->skip : 0);
+    }
+
     /* calculate skip amount, rewinding if needed for back seek when reading */
     if (offset < 0) {
         if (state->mode != GZ_READ)         /* writing -- can't go backwards */
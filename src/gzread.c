@@ -12,6 +12,9 @@ local int gz_look OF((gz_statep));
 local int gz_decomp OF((gz_statep));
 local int gz_fetch OF((gz_statep));
 local int gz_skip OF((gz_statep, z_off64_t));
+local int gz_read_at OF((gz_statep, z_off64_t, unsigned char *, unsigned));
+local int gz_walk OF((gz_statep));
+local int gz_index OF((gz_statep));
 
 /* Use read() to load a buffer -- return -1 on error, otherwise 0.  Read from
    state->fd, and update state->eof, state->err, and state->msg as appropriate.
@@ -284,6 +287,240 @@ local int gz_skip(state, len)
     return 0;
 }
 
+/* Read len bytes at offset off in the file into buf.  Return the number of
+   bytes read, which is less than len only at the end of the file, or -1 on
+   error.  This moves the file position, and does not change the input. */
+local int gz_read_at(state, off, buf, len)
+    gz_statep state;
+    z_off64_t off;
+    unsigned char *buf;
+    unsigned len;
+{
+    int ret = 0;
+    unsigned have = 0;
+
+    if (LSEEK(state->fd, off, SEEK_SET) == -1) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    while (have < len) {
+        ret = read(state->fd, buf + have, len - have);
+        if (ret <= 0)
+            break;
+        have += ret;
+    }
+    if (ret < 0) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    return (int)have;
+}
+
+/* Add member bn to the member list, using the size in its "BC" subfield and
+   the uncompressed length in its trailer.  If there is no member there, or it
+   does not have a "BC" subfield, then the list is complete.  Return -1 on
+   error. */
+local int gz_walk(state)
+    gz_statep state;
+{
+    unsigned char buf[18];
+    unsigned size;
+    z_off64_t off;
+    int got;
+
+    off = state->start + state->boff[state->bn];
+    got = gz_read_at(state, off, buf, 18);
+    if (got == -1)
+        return -1;
+    if (got < 18 || buf[0] != 31 || buf[1] != 139 || buf[2] != 8 ||
+            (buf[3] & 4) == 0 || buf[12] != 'B' || buf[13] != 'C' ||
+            buf[14] != 2 || buf[15] != 0) {
+        state->bdone = 1;
+        return 0;
+    }
+    size = buf[16] + ((unsigned)buf[17] << 8) + 1;
+    got = size < 28 ? 0 : gz_read_at(state, off + size - 4, buf, 4);
+    if (got == -1)
+        return -1;
+    if (got < 4) {
+        state->bdone = 1;
+        return 0;
+    }
+    if (gz_grow(state) == -1)
+        return -1;
+    state->boff[state->bn + 1] = state->boff[state->bn] + size;
+    state->bpos[state->bn + 1] = state->bpos[state->bn] +
+        (buf[0] + ((unsigned long)buf[1] << 8) +
+         ((unsigned long)buf[2] << 16) + ((unsigned long)buf[3] << 24));
+    state->bn++;
+    return 0;
+}
+
+/* Load the member list from the index member at the end of the file, if
+   there is one and it covers the whole file.  The index member is an empty
+   blocked member, with an "IX" subfield after the "BC" subfield that has the
+   compressed size less one and the uncompressed size of each member before
+   it, two bytes each, and then an "IO" subfield with the size of the index
+   member less one, which is found at sixteen bytes from the end of the file.
+   Return 1 if the list was loaded, 0 if not, or -1 on error. */
+local int gz_index(state)
+    gz_statep state;
+{
+    unsigned char buf[16], *idx, *p;
+    z_off64_t end, beg;
+    unsigned size, n, k;
+    int got;
+
+    end = LSEEK(state->fd, 0, SEEK_END);
+    if (end == -1 || end - state->start < 38)
+        return 0;
+    got = gz_read_at(state, end - 16, buf, 16);
+    if (got == -1)
+        return -1;
+    if (got < 16 || buf[0] != 'I' || buf[1] != 'O' || buf[2] != 2 ||
+            buf[3] != 0 || buf[6] != 3 || buf[7] != 0)
+        return 0;
+    for (k = 8; k < 16; k++)
+        if (buf[k])
+            return 0;
+    size = buf[4] + ((unsigned)buf[5] << 8) + 1;
+    beg = end - size;
+    if (size < 38 || ((size - 38) & 3) || beg < state->start)
+        return 0;
+    n = (size - 38) >> 2;
+
+    /* read the index member and check its header */
+    idx = (unsigned char *)malloc(size);
+    if (idx == NULL) {
+        gz_error(state, Z_MEM_ERROR, "out of memory");
+        return -1;
+    }
+    got = gz_read_at(state, beg, idx, size);
+    if (got == -1) {
+        free(idx);
+        return -1;
+    }
+    if ((unsigned)got < size || idx[0] != 31 || idx[1] != 139 ||
+            idx[2] != 8 || idx[3] != 4 ||
+            idx[10] + ((unsigned)idx[11] << 8) != size - 22 ||
+            idx[12] != 'B' || idx[13] != 'C' || idx[14] != 2 || idx[15] != 0 ||
+            idx[16] + ((unsigned)idx[17] << 8) != size - 1 ||
+            idx[18] != 'I' || idx[19] != 'X' ||
+            idx[20] + ((unsigned)idx[21] << 8) != n << 2) {
+        free(idx);
+        return 0;
+    }
+
+    /* make the member list, working back from the index member */
+    state->bn = n;
+    if (gz_grow(state) == -1) {
+        free(idx);
+        return -1;
+    }
+    state->boff[n] = beg - state->start;
+    state->bpos[0] = 0;
+    for (k = 0, p = idx + 22; k < n; k++, p += 4)
+        state->bpos[k + 1] = state->bpos[k] + p[2] + ((unsigned)p[3] << 8);
+    for (k = n; k; k--) {
+        p -= 4;
+        state->boff[k - 1] = state->boff[k] - (p[0] + ((unsigned)p[1] << 8) + 1);
+    }
+    free(idx);
+    if (state->boff[0] != 0) {          /* something is in front of it */
+        state->boff[0] = 0;
+        state->bn = 0;
+        return 0;
+    }
+    state->bn = n;
+    state->bdone = 1;
+    return 1;
+}
+
+/* Go to the start of the member that has the uncompressed offset target in
+   a blocked gzip file, and request a skip to target from there.  On the first
+   call, find out if the file is blocked by looking for an index member, or
+   else for a "BC" subfield in the first member.  Return 0 if it went there,
+   1 if the file is not blocked or target is ahead in the current member, in
+   which case nothing is changed, or -1 on error. */
+int ZLIB_INTERNAL gz_jump(state, target)
+    gz_statep state;
+    z_off64_t target;
+{
+    z_off64_t here;
+    unsigned lo, hi, mid;
+    int ret;
+
+    /* remember where the input is, in case this does not jump */
+    here = LSEEK(state->fd, 0, SEEK_CUR);
+    if (here == -1) {
+        state->blocked = 0;
+        return 1;
+    }
+
+    /* the first time, see if the file is blocked */
+    if (state->blocked == -1) {
+        state->blocked = 0;
+        state->bn = 0;
+        if (gz_grow(state) == -1)
+            return -1;
+        state->boff[0] = state->bpos[0] = 0;
+        ret = gz_index(state);
+        if (ret == -1)
+            return -1;
+        if (ret == 1)
+            state->blocked = 2;
+        else {
+            if (gz_walk(state) == -1)
+                return -1;
+            if (state->bn)
+                state->blocked = 1;
+        }
+        if (state->blocked == 0) {
+            free(state->bpos);
+            free(state->boff);
+            state->boff = state->bpos = NULL;
+            state->bn = state->bmax = 0;
+            return LSEEK(state->fd, here, SEEK_SET) == -1 ? -1 : 1;
+        }
+    }
+
+    /* learn the members up to the one with target */
+    while (!state->bdone && state->bpos[state->bn] <= target)
+        if (gz_walk(state) == -1)
+            return -1;
+
+    /* find the last member that starts at or before target */
+    lo = 0;
+    hi = state->bn;
+    while (lo < hi) {
+        mid = (lo + hi + 1) >> 1;
+        if (state->bpos[mid] <= target)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    /* if target is ahead in the current member, then just skip to it */
+    if (state->bpos[lo] <= state->x.pos && state->x.pos <= target)
+        return LSEEK(state->fd, here, SEEK_SET) == -1 ? -1 : 1;
+
+    /* go to the start of the member */
+    if (LSEEK(state->fd, state->start + state->boff[lo], SEEK_SET) == -1) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    state->x.have = 0;
+    state->eof = 0;
+    state->past = 0;
+    state->how = LOOK;
+    state->strm.avail_in = 0;
+    gz_error(state, Z_OK, NULL);
+    state->x.pos = state->bpos[lo];
+    state->seek = target > state->x.pos;
+    state->skip = target - state->x.pos;
+    return 0;
+}
+
 /* -- see zlib.h -- */
 int ZEXPORT gzread(file, buf, len)
     gzFile file;
@@ -585,6 +822,10 @@ int ZEXPORT gzclose_r(file)
         free(state->out);
         free(state->in);
     }
+    if (state->boff != NULL) {
+        free(state->bpos);
+        free(state->boff);
+    }
     err = state->err == Z_BUF_ERROR ? Z_BUF_ERROR : Z_OK;
     gz_error(state, Z_OK, NULL);
     free(state->path);
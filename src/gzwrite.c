@@ -8,6 +8,8 @@
 /* Local functions */
 local int gz_init OF((gz_statep));
 local int gz_comp OF((gz_statep, int));
+local int gz_block OF((gz_statep, int));
+local int gz_tail OF((gz_statep));
 local int gz_zero OF((gz_statep, z_off64_t));
 
 /* Initialize state for writing a gzip file.  Mark initialization by setting
@@ -27,8 +29,9 @@ local int gz_init(state)
 
     /* only need output buffer and deflate state if compressing */
     if (!state->direct) {
-        /* allocate output buffer */
-        state->out = (unsigned char *)malloc(state->want);
+        /* allocate output buffer, big enough for a whole member if blocked */
+        state->out = (unsigned char *)malloc(state->blocked ? BGZF_MAX :
+                                                              state->want);
         if (state->out == NULL) {
             free(state->in);
             gz_error(state, Z_MEM_ERROR, "out of memory");
@@ -47,6 +50,36 @@ local int gz_init(state)
             gz_error(state, Z_MEM_ERROR, "out of memory");
             return -1;
         }
+        if (state->rsyncable)
+            deflateRsyncable(strm, 12);
+
+        /* put the member size subfield in each header if blocked */
+        if (state->blocked) {
+            state->bextra[0] = 'B';
+            state->bextra[1] = 'C';
+            state->bextra[2] = 2;
+            state->bextra[3] = 0;
+            state->bextra[4] = state->bextra[5] = 0;
+            state->bhead.text = 0;
+            state->bhead.time = 0;
+            state->bhead.os = 255;
+            state->bhead.extra = state->bextra;
+            state->bhead.extra_len = 6;
+            state->bhead.name = Z_NULL;
+            state->bhead.comment = Z_NULL;
+            state->bhead.hcrc = 0;
+            deflateSetHeader(strm, &(state->bhead));
+            if (state->blocked == 2) {
+                state->bn = 0;
+                if (gz_grow(state) == -1) {
+                    (void)deflateEnd(strm);
+                    free(state->out);
+                    free(state->in);
+                    return -1;
+                }
+                state->boff[0] = state->bpos[0] = 0;
+            }
+        }
     }
 
     /* mark state as initialized */
@@ -54,7 +87,7 @@ local int gz_init(state)
 
     /* initialize write buffer if compressing */
     if (!state->direct) {
-        strm->avail_out = state->size;
+        strm->avail_out = state->blocked ? BGZF_MAX : state->size;
         strm->next_out = state->out;
         state->x.next = strm->next_out;
     }
@@ -90,6 +123,10 @@ local int gz_comp(state, flush)
         return 0;
     }
 
+    /* write whole members if blocked */
+    if (state->blocked)
+        return gz_block(state, flush);
+
     /* run deflate() on provided input until it produces no more output */
     ret = Z_OK;
     do {
@@ -129,6 +166,147 @@ local int gz_comp(state, flush)
     return 0;
 }
 
+/* Compress whatever is at avail_in and next_in into blocked gzip members, and
+   write each member when it is complete.  A member is complete when it has
+   BGZF_BLOCK bytes of input, or on any flush if it has any input, so that it
+   always fits in the output buffer.  The "BC" subfield is then filled in with
+   the member size less one, and the sizes of the member are noted for the
+   index if requested.  Return -1 on error, otherwise 0. */
+local int gz_block(state, flush)
+    gz_statep state;
+    int flush;
+{
+    int ret, got;
+    unsigned n, left, have;
+    z_streamp strm = &(state->strm);
+
+    for (;;) {
+        /* compress as much input as will fit in the current member */
+        n = BGZF_BLOCK - state->bin;
+        if (n > strm->avail_in)
+            n = strm->avail_in;
+        left = strm->avail_in - n;
+        strm->avail_in = n;
+        ret = deflate(strm, Z_NO_FLUSH);
+        if (ret == Z_STREAM_ERROR || strm->avail_in) {
+            gz_error(state, Z_STREAM_ERROR,
+                      "internal error: deflate stream corrupt");
+            return -1;
+        }
+        state->bin += n;
+
+        /* done if the member is not complete (then there is no input left) */
+        if (state->bin < BGZF_BLOCK && (flush == Z_NO_FLUSH || state->bin == 0))
+            return 0;
+
+        /* finish the member and write it */
+        ret = deflate(strm, Z_FINISH);
+        if (ret != Z_STREAM_END) {
+            gz_error(state, Z_STREAM_ERROR,
+                      "internal error: blocked member too large");
+            return -1;
+        }
+        have = (unsigned)(strm->next_out - state->out);
+        state->out[16] = (unsigned char)(have - 1);
+        state->out[17] = (unsigned char)((have - 1) >> 8);
+        got = write(state->fd, state->out, have);
+        if (got < 0 || (unsigned)got != have) {
+            gz_error(state, Z_ERRNO, zstrerror());
+            return -1;
+        }
+
+        /* note the member sizes for the index, if there's room for them */
+        if (state->blocked == 2) {
+            if (state->bn == (BGZF_MAX - 38) >> 2) {
+                free(state->bpos);
+                free(state->boff);
+                state->boff = state->bpos = NULL;
+                state->blocked = 1;
+            }
+            else {
+                state->bn++;
+                if (gz_grow(state) == -1)
+                    return -1;
+                state->boff[state->bn] = state->boff[state->bn - 1] + have;
+                state->bpos[state->bn] = state->bpos[state->bn - 1] +
+                                         state->bin;
+            }
+        }
+
+        /* start the next member */
+        deflateReset(strm);
+        deflateSetHeader(strm, &(state->bhead));
+        strm->next_out = state->out;
+        strm->avail_out = BGZF_MAX;
+        state->x.next = strm->next_out;
+        state->bin = 0;
+        strm->avail_in = left;
+    }
+}
+
+/* Write the empty member that ends a blocked gzip file.  If an index was
+   requested, then that member has an "IX" subfield with the compressed size
+   less one and the uncompressed size of each member, two bytes each, and an
+   "IO" subfield at sixteen bytes from the end of the file with the size of
+   the index member less one, so that a reader can find the index.  Otherwise
+   it is the usual 28-byte end-of-file member.  Return -1 on error, otherwise
+   0. */
+local int gz_tail(state)
+    gz_statep state;
+{
+    int got;
+    unsigned n, len, k;
+    unsigned char *next = state->out;
+
+    n = state->blocked == 2 ? state->bn : 0;
+    len = state->blocked == 2 ? 38 + (n << 2) : 28;
+    *next++ = 31;
+    *next++ = 139;
+    *next++ = 8;
+    *next++ = 4;                        /* FEXTRA */
+    *next++ = 0; *next++ = 0; *next++ = 0; *next++ = 0;
+    *next++ = 0;
+    *next++ = 255;
+    *next++ = (unsigned char)(len - 22);
+    *next++ = (unsigned char)((len - 22) >> 8);
+    *next++ = 'B';
+    *next++ = 'C';
+    *next++ = 2;
+    *next++ = 0;
+    *next++ = (unsigned char)(len - 1);
+    *next++ = (unsigned char)((len - 1) >> 8);
+    if (state->blocked == 2) {
+        *next++ = 'I';
+        *next++ = 'X';
+        *next++ = (unsigned char)(n << 2);
+        *next++ = (unsigned char)((n << 2) >> 8);
+        for (k = 0; k < n; k++) {
+            got = (int)(state->boff[k + 1] - state->boff[k] - 1);
+            *next++ = (unsigned char)got;
+            *next++ = (unsigned char)(got >> 8);
+            got = (int)(state->bpos[k + 1] - state->bpos[k]);
+            *next++ = (unsigned char)got;
+            *next++ = (unsigned char)(got >> 8);
+        }
+        *next++ = 'I';
+        *next++ = 'O';
+        *next++ = 2;
+        *next++ = 0;
+        *next++ = (unsigned char)(len - 1);
+        *next++ = (unsigned char)((len - 1) >> 8);
+    }
+    *next++ = 3;                        /* empty fixed block */
+    *next++ = 0;
+    for (k = 0; k < 8; k++)             /* check value and length of nothing */
+        *next++ = 0;
+    got = write(state->fd, state->out, len);
+    if (got < 0 || (unsigned)got != len) {
+        gz_error(state, Z_ERRNO, zstrerror());
+        return -1;
+    }
+    return 0;
+}
+
 /* Compress len zeros to output.  Return -1 on error, 0 on success. */
 local int gz_zero(state, len)
     gz_statep state;
@@ -526,7 +704,8 @@ int ZEXPORT gzsetparams(file, level, strategy)
     /* change compression parameters for subsequent input */
     if (state->size) {
         /* flush previous input with previous parameters before changing */
-        if (strm->avail_in && gz_comp(state, Z_PARTIAL_FLUSH) == -1)
+        if ((strm->avail_in || state->bin) &&
+                gz_comp(state, Z_PARTIAL_FLUSH) == -1)
             return state->err;
         deflateParams(strm, level, strategy);
     }
@@ -563,11 +742,17 @@ int ZEXPORT gzclose_w(file)
         ret = state->err;
     if (state->size) {
         if (!state->direct) {
+            if (state->blocked && gz_tail(state) == -1)
+                ret = state->err;
             (void)deflateEnd(&(state->strm));
             free(state->out);
         }
         free(state->in);
     }
+    if (state->boff != NULL) {
+        free(state->bpos);
+        free(state->boff);
+    }
     gz_error(state, Z_OK, NULL);
     free(state->path);
     if (close(state->fd) == -1)
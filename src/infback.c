@@ -453,12 +453,12 @@ void FAR *out_desc;
                 break;
             }
 
-            /* build code tables -- note: do not change the lenbits or distbits
-               values here (9 and 6) without reading the comments in inftrees.h
-               concerning the ENOUGH constants, which depend on those values */
+            /* build code tables -- note: the root table sizes are set with
+               ROOT_LENBITS and ROOT_DISTBITS in inftrees.h, where the ENOUGH
+               constants that depend on those values are */
             state->next = state->codes;
             state->lencode = (code const FAR *)(state->next);
-            state->lenbits = 9;
+            state->lenbits = ROOT_LENBITS;
             ret = inflate_table(LENS, state->lens, state->nlen, &(state->next),
                                 &(state->lenbits), state->work);
             if (ret) {
@@ -466,8 +466,11 @@ void FAR *out_desc;
                 state->mode = BAD;
                 break;
             }
+#ifndef ASMINF
+            inflate_pairs(state->codes, state->lenbits);
+#endif
             state->distcode = (code const FAR *)(state->next);
-            state->distbits = 6;
+            state->distbits = ROOT_DISTBITS;
             ret = inflate_table(DISTS, state->lens + state->nlen, state->ndist,
                             &(state->next), &(state->distbits), state->work);
             if (ret) {
@@ -492,6 +495,11 @@ void FAR *out_desc;
             /* get a literal, length, or end-of-block code */
             for (;;) {
                 here = state->lencode[BITS(state->lenbits)];
+                if (here.op & 128) {    /* just the first of two literals */
+                    here.bits = (unsigned char)(here.op & 15);
+                    here.op = 0;
+                    here.val &= 0xff;
+                }
                 if ((unsigned)(here.bits) <= bits) break;
                 PULLBYTE();
             }
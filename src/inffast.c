@@ -29,6 +29,54 @@
 #  define PUP(a) *++(a)
 #endif
 
+local unsigned char FAR *copy_match OF((unsigned char FAR *put,
+                                        unsigned dist, unsigned len));
+
+/*
+   Copy a match of len >= 16 bytes at put from dist bytes back, and return
+   the new put.  The bytes are copied sixteen at a time, which is safe for a
+   distance of sixteen or more even when the match overlaps itself.  For a
+   shorter distance, such as one in a run of a single byte, the match repeats
+   every dist bytes, so the first dist bytes are repeated in a small buffer
+   that is then copied over and over, advancing by a whole number of periods.
+   Nothing is written past the end of the match.
+ */
+local unsigned char FAR *copy_match(put, dist, len)
+unsigned char FAR *put;
+unsigned dist;
+unsigned len;
+{
+    const unsigned char FAR *from;
+    unsigned char pat[16];
+    unsigned k, step;
+
+    from = put - dist;
+    if (dist >= 16) {
+        do {
+            zmemcpy(put, from, 16);
+            put += 16;
+            from += 16;
+            len -= 16;
+        } while (len >= 16);
+    }
+    else {
+        for (k = 0; k < dist; k++)
+            pat[k] = from[k];
+        for (; k < 16; k++)
+            pat[k] = pat[k - dist];
+        step = 16 - 16 % dist;
+        do {
+            zmemcpy(put, pat, 16);
+            put += step;
+            len -= step;
+        } while (len >= 16);
+        from = put - dist;
+    }
+    while (len--)
+        *put++ = *from++;
+    return put;
+}
+
 /*
    Decode literal, length, and distance codes and write out the resulting
    literal and match bytes until either not enough input or output is
@@ -136,6 +184,12 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                     "inflate:         literal 0x%02x\n", here.val));
             PUP(out) = (unsigned char)(here.val);
         }
+        else if (op & 128) {                    /* two literals */
+            Tracevv((stderr, "inflate:         literals 0x%02x 0x%02x\n",
+                    here.val & 0xff, here.val >> 8));
+            PUP(out) = (unsigned char)(here.val);
+            PUP(out) = (unsigned char)(here.val >> 8);
+        }
         else if (op & 16) {                     /* length base */
             len = (unsigned)(here.val);
             op &= 15;                           /* number of extra bits */
@@ -265,6 +319,8 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                             PUP(out) = PUP(from);
                     }
                 }
+                else if (len >= 16)             /* long copy from output */
+                    out = copy_match(out + OFF, dist, len) - OFF;
                 else {
                     from = out - dist;          /* copy direct from output */
                     do {                        /* minimum length is three */
@@ -338,3 +394,259 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
  */
 
 #endif /* !ASMINF */
+
+/*
+   Decode literal, length, and distance codes like inflate_fast(), but with
+   any amount of input and output.  Before each code is used, all of its bits
+   must be in the input and all of its bytes must fit in the output, or else
+   the code is left for inflate() to decode a piece at a time.  inflate()
+   uses this when it has less than inflate_fast() needs, as when streaming
+   small buffers, so that only the last code of each call is decoded by the
+   slower state machine in inflate().
+
+   Entry assumptions:
+
+        state->mode == LEN
+        start >= strm->avail_out
+
+   On return, state->mode is one of:
+
+        LEN -- the next code does not entirely fit in the input or output
+        TYPE -- reached end of block code, inflate() to interpret next block
+        BAD -- error in block data
+
+   A distance too far back that INFLATE_ALLOW_INVALID_DISTANCE_TOOFAR_ARRR
+   permits is left for inflate() as well.
+ */
+void ZLIB_INTERNAL inflate_small(strm, start)
+z_streamp strm;
+unsigned start;         /* inflate()'s starting value for strm->avail_out */
+{
+    struct inflate_state FAR *state;
+    z_const unsigned char FAR *in;      /* local strm->next_in */
+    z_const unsigned char FAR *first;   /* strm->next_in on entry */
+    z_const unsigned char FAR *last;    /* end of available input */
+    z_const unsigned char FAR *was;     /* in at start of current code */
+    unsigned char FAR *out;     /* local strm->next_out */
+    unsigned char FAR *beg;     /* inflate()'s initial strm->next_out */
+    unsigned char FAR *end;     /* end of available output */
+    unsigned wsize;             /* window size or zero if not using window */
+    unsigned whave;             /* valid bytes in the window */
+    unsigned wnext;             /* window write index */
+    unsigned char FAR *window;  /* allocated sliding window, if wsize != 0 */
+    unsigned long hold;         /* local strm->hold */
+    unsigned bits;              /* local strm->bits */
+    unsigned long washold;      /* hold at start of current code */
+    unsigned wasbits;           /* bits at start of current code */
+    code const FAR *lcode;      /* local strm->lencode */
+    code const FAR *dcode;      /* local strm->distcode */
+    unsigned lmask;             /* mask for first level of length codes */
+    unsigned dmask;             /* mask for first level of distance codes */
+    code here;                  /* retrieved table entry */
+    unsigned op;                /* code bits, operation, extra bits, or */
+                                /*  window position, window bytes to copy */
+    unsigned len;               /* match length, unused bytes */
+    unsigned dist;              /* match distance */
+    unsigned char FAR *from;    /* where to copy match from */
+
+    /* copy state to local variables */
+    state = (struct inflate_state FAR *)strm->state;
+    first = in = strm->next_in;
+    last = in + strm->avail_in;
+    out = strm->next_out;
+    beg = out - (start - strm->avail_out);
+    end = out + strm->avail_out;
+    wsize = state->wsize;
+    whave = state->whave;
+    wnext = state->wnext;
+    window = state->window;
+    hold = state->hold;
+    bits = state->bits;
+    lcode = state->lencode;
+    dcode = state->distcode;
+    lmask = (1U << state->lenbits) - 1;
+    dmask = (1U << state->distbits) - 1;
+
+/* get at least n bits, or back up to the start of the code if not there */
+#define NEED(n) \
+    do { \
+        while (bits < (unsigned)(n)) { \
+            if (in == last) goto back; \
+            hold += (unsigned long)(*in++) << bits; \
+            bits += 8; \
+        } \
+    } while (0)
+
+/* get up to 15 bits, as many as there are */
+#define MORE() \
+    do { \
+        while (bits < 15 && in < last) { \
+            hold += (unsigned long)(*in++) << bits; \
+            bits += 8; \
+        } \
+    } while (0)
+
+    /* decode codes until one does not fit, an end-of-block, or an error */
+    for (;;) {
+        was = in;
+        washold = hold;
+        wasbits = bits;
+
+        /* get a literal, length, or end-of-block code */
+        MORE();
+        here = lcode[hold & lmask];
+        if (here.op & 128) {                    /* two literals */
+            if (here.bits <= bits && end - out >= 2) {
+                hold >>= here.bits;
+                bits -= here.bits;
+                *out++ = (unsigned char)(here.val);
+                *out++ = (unsigned char)(here.val >> 8);
+                continue;
+            }
+            here.bits = (unsigned char)(here.op & 15);
+            here.op = 0;
+            here.val &= 0xff;
+        }
+        if (here.bits > bits)
+            goto back;
+        if (here.op && (here.op & 0xf0) == 0) { /* 2nd level length code */
+            op = here.bits;
+            NEED(op + here.op);
+            here = lcode[here.val + ((hold >> op) & ((1U << here.op) - 1))];
+            hold >>= op;
+            bits -= op;
+        }
+        op = (unsigned)(here.op);
+        if (op == 0) {                          /* literal */
+            if (out == end)
+                goto back;
+            hold >>= here.bits;
+            bits -= here.bits;
+            *out++ = (unsigned char)(here.val);
+            continue;
+        }
+        if (op & 32) {                          /* end-of-block */
+            hold >>= here.bits;
+            bits -= here.bits;
+            state->mode = TYPE;
+            break;
+        }
+        if (op & 64) {
+            strm->msg = (char *)"invalid literal/length code";
+            state->mode = BAD;
+            break;
+        }
+
+        /* length base and extra bits */
+        hold >>= here.bits;
+        bits -= here.bits;
+        len = (unsigned)(here.val);
+        op &= 15;
+        if (op) {
+            NEED(op);
+            len += (unsigned)hold & ((1U << op) - 1);
+            hold >>= op;
+            bits -= op;
+        }
+        if ((unsigned)(end - out) < len)
+            goto back;
+
+        /* distance code */
+        MORE();
+        here = dcode[hold & dmask];
+        if (here.bits > bits)
+            goto back;
+        if ((here.op & 0xf0) == 0) {            /* 2nd level distance code */
+            op = here.bits;
+            NEED(op + here.op);
+            here = dcode[here.val + ((hold >> op) & ((1U << here.op) - 1))];
+            hold >>= op;
+            bits -= op;
+        }
+        op = (unsigned)(here.op);
+        if (op & 64) {
+            strm->msg = (char *)"invalid distance code";
+            state->mode = BAD;
+            break;
+        }
+        hold >>= here.bits;
+        bits -= here.bits;
+        dist = (unsigned)(here.val);
+        op &= 15;
+        if (op) {
+            NEED(op);
+            dist += (unsigned)hold & ((1U << op) - 1);
+            hold >>= op;
+            bits -= op;
+        }
+#ifdef INFLATE_STRICT
+        if (dist > state->dmax) {
+            strm->msg = (char *)"invalid distance too far back";
+            state->mode = BAD;
+            break;
+        }
+#endif
+
+        /* copy the match, first any of it that is in the window */
+        op = (unsigned)(out - beg);             /* max distance in output */
+        if (dist > op) {
+            op = dist - op;                     /* distance back in window */
+            if (op > whave) {
+                if (state->sane) {
+                    strm->msg = (char *)"invalid distance too far back";
+                    state->mode = BAD;
+                    break;
+                }
+                goto back;
+            }
+            do {
+                if (op > wnext) {               /* up to end of window */
+                    from = window + (wsize - (op - wnext));
+                    dist = op - wnext;
+                }
+                else {                          /* up to wnext */
+                    from = window + (wnext - op);
+                    dist = op;
+                }
+                if (dist > len)
+                    dist = len;
+                len -= dist;
+                op -= dist;
+                do {
+                    *out++ = *from++;
+                } while (--dist);
+            } while (len && op);
+            from = beg;
+        }
+        else
+            from = out - dist;
+        while (len--)
+            *out++ = *from++;
+        continue;
+
+        /* the code is not all there -- leave it for inflate() */
+      back:
+        in = was;
+        hold = washold;
+        bits = wasbits;
+        break;
+    }
+#undef NEED
+#undef MORE
+
+    /* return unused whole bytes taken from the input in this call */
+    len = bits >> 3;
+    if (len > (unsigned)(in - first))
+        len = (unsigned)(in - first);
+    in -= len;
+    bits -= len << 3;
+    hold &= (1UL << bits) - 1;
+
+    /* update state and return */
+    strm->avail_in -= (unsigned)(in - first);
+    strm->next_in = in;
+    strm->avail_out -= (unsigned)(out - strm->next_out);
+    strm->next_out = out;
+    state->hold = hold;
+    state->bits = bits;
+}
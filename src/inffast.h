@@ -9,3 +9,4 @@
  */
 
 void ZLIB_INTERNAL inflate_fast OF((z_streamp strm, unsigned start));
+void ZLIB_INTERNAL inflate_small OF((z_streamp strm, unsigned start));
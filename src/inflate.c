@@ -94,13 +94,29 @@
 /* function prototypes */
 local void fixedtables OF((struct inflate_state FAR *state));
 local int updatewindow OF((z_streamp strm, const unsigned char FAR *end,
-                           unsigned copy));
+                           unsigned copy, int check));
+local int codetables OF((z_streamp strm));
+local void windowlast OF((struct inflate_state FAR *state,
+                          unsigned char FAR *dest, unsigned len));
+#if INFLATE_CACHE
+local unsigned long cachekey OF((struct inflate_state FAR *state));
+local struct inflate_slot FAR *cachefind OF((struct inflate_state FAR *state,
+                                             unsigned long key));
+local struct inflate_slot FAR *cacheslot OF((z_streamp strm,
+                                             unsigned long key));
+local void cachekeep OF((struct inflate_state FAR *state,
+                         struct inflate_slot FAR *slot));
+#endif
 #ifdef BUILDFIXED
    void makefixed OF((void));
 #endif
 local unsigned syncsearch OF((unsigned FAR *have, const unsigned char FAR *buf,
                               unsigned len));
 
+/* permutation of code lengths, in dynamic block headers and checkpoints */
+local const unsigned short order[19] =
+    {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
 int ZEXPORT inflateResetKeep(strm)
 z_streamp strm;
 {
@@ -133,6 +149,11 @@ z_streamp strm;
 
     if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
     state = (struct inflate_state FAR *)strm->state;
+    if (state->shared) {            /* drop caller's dictionary or ring */
+        state->window = state->wsave;
+        state->shared = 0;
+        state->ring = 0;
+    }
     state->wsize = 0;
     state->whave = 0;
     state->wnext = 0;
@@ -156,7 +177,7 @@ int windowBits;
         windowBits = -windowBits;
     }
     else {
-        wrap = (windowBits >> 4) + 1;
+        wrap = (windowBits >> 4) + 5;
 #ifdef GUNZIP
         if (windowBits < 48)
             windowBits &= 15;
@@ -166,6 +187,11 @@ int windowBits;
     /* set number of window bits, free window if different */
     if (windowBits && (windowBits < 8 || windowBits > 15))
         return Z_STREAM_ERROR;
+    if (state->shared) {
+        state->window = state->wsave;
+        state->shared = 0;
+        state->ring = 0;
+    }
     if (state->window != Z_NULL && state->wbits != (unsigned)windowBits) {
         ZFREE(strm, state->window);
         state->window = Z_NULL;
@@ -211,6 +237,16 @@ int stream_size;
     Tracev((stderr, "inflate: allocated\n"));
     strm->state = (struct internal_state FAR *)state;
     state->window = Z_NULL;
+    state->shared = 0;
+    state->ring = 0;
+#if INFLATE_CACHE
+    for (ret = 0; ret < INFLATE_CACHE; ret++) {
+        state->slot[ret] = Z_NULL;
+        state->seen[ret] = 0;
+    }
+    state->nseen = 0;
+    state->uses = 0;
+#endif
     ret = inflateReset2(strm, windowBits);
     if (ret != Z_OK) {
         ZFREE(strm, state);
@@ -248,6 +284,21 @@ int value;
     return Z_OK;
 }
 
+int ZEXPORT inflateValidate(strm, check)
+z_streamp strm;
+int check;
+{
+    struct inflate_state FAR *state;
+
+    if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+    if (check && state->wrap)
+        state->wrap |= 4;
+    else
+        state->wrap &= ~4;
+    return Z_OK;
+}
+
 /*
    Return state with length and distance decoding tables and index sizes set to
    fixed code decoding.  Normally this returns fixed tables from inffixed.h.
@@ -362,6 +413,28 @@ void makefixed()
 }
 #endif /* MAKEFIXED */
 
+/* check functions to use adler32() for zlib or crc32() for gzip, the second
+   also copying the data */
+#ifdef GUNZIP
+#  define UPDATE(check, buf, len) \
+    (state->flags ? crc32(check, buf, len) : adler32(check, buf, len))
+#  define UPDATE_COPY(check, dst, buf, len) \
+    (state->flags ? crc32_copy(check, dst, buf, len) : \
+                    adler32_copy(check, dst, buf, len))
+#else
+#  define UPDATE(check, buf, len) adler32(check, buf, len)
+#  define UPDATE_COPY(check, dst, buf, len) adler32_copy(check, dst, buf, len)
+#endif
+
+/* copy to the window, updating the check value on the way if check is true */
+#define WINCOPY(dst, buf, len) \
+    do { \
+        if (check) \
+            state->check = UPDATE_COPY(state->check, dst, buf, len); \
+        else \
+            zmemcpy(dst, buf, len); \
+    } while (0)
+
 /*
    Update the window with the last wsize (normally 32K) bytes written before
    returning.  If window does not exist yet, create it.  This is only called
@@ -370,22 +443,37 @@ void makefixed()
    It is also called to create a window for dictionary data when a dictionary
    is loaded.
 
+   If check is true, then the copy bytes of output ending at end are also
+   added to state->check, with the last wsize of them checked while they are
+   copied into the window.  That saves inflate() a separate pass over the
+   output.
+
    Providing output buffers larger than 32K to inflate() should provide a speed
    advantage, since only the last 32K of output is copied to the sliding window
    upon return from inflate(), and since all distances after the first 32K of
    output will fall in the output data, making match copies simpler and faster.
    The advantage may be dependent on the size of the processor's data caches.
  */
-local int updatewindow(strm, end, copy)
+local int updatewindow(strm, end, copy, check)
 z_streamp strm;
 const Bytef *end;
 unsigned copy;
+int check;
 {
     struct inflate_state FAR *state;
+    const unsigned char FAR *dict;
     unsigned dist;
 
     state = (struct inflate_state FAR *)strm->state;
 
+    /* stop using a dictionary from inflateUseDictionary() as the window */
+    dict = Z_NULL;
+    if (state->shared && !state->ring) {
+        dict = state->window;
+        state->window = state->wsave;
+        state->shared = 0;
+    }
+
     /* if it hasn't been done already, allocate space for the window */
     if (state->window == Z_NULL) {
         state->window = (unsigned char FAR *)
@@ -394,6 +482,13 @@ unsigned copy;
         if (state->window == Z_NULL) return 1;
     }
 
+    /* the dictionary is now the window contents, copied only when needed */
+    if (dict != Z_NULL) {
+        zmemcpy(state->window, dict, state->whave);
+        state->wsize = 1U << state->wbits;
+        state->wnext = state->whave == state->wsize ? 0 : state->whave;
+    }
+
     /* if window not in use yet, initialize */
     if (state->wsize == 0) {
         state->wsize = 1U << state->wbits;
@@ -403,17 +498,20 @@ unsigned copy;
 
     /* copy state->wsize or less output bytes into the circular window */
     if (copy >= state->wsize) {
-        zmemcpy(state->window, end - state->wsize, state->wsize);
+        if (check && copy > state->wsize)
+            state->check = UPDATE(state->check, end - copy,
+                                  copy - state->wsize);
+        WINCOPY(state->window, end - state->wsize, state->wsize);
         state->wnext = 0;
         state->whave = state->wsize;
     }
     else {
         dist = state->wsize - state->wnext;
         if (dist > copy) dist = copy;
-        zmemcpy(state->window + state->wnext, end - copy, dist);
+        WINCOPY(state->window + state->wnext, end - copy, dist);
         copy -= dist;
         if (copy) {
-            zmemcpy(state->window, end - copy, copy);
+            WINCOPY(state->window, end - copy, copy);
             state->wnext = copy;
             state->whave = state->wsize;
         }
@@ -426,15 +524,173 @@ unsigned copy;
     return 0;
 }
 
-/* Macros for inflate(): */
+/*
+   Copy the newest len bytes of the window, oldest first, to dest.  len must
+   be at least one, and not more than state->whave.
+ */
+local void windowlast(state, dest, len)
+struct inflate_state FAR *state;
+unsigned char FAR *dest;
+unsigned len;
+{
+    unsigned start, copy;
+
+    start = (state->wnext + (state->wsize - len)) % state->wsize;
+    copy = state->wsize - start;
+    if (copy > len)
+        copy = len;
+    zmemcpy(dest, state->window + start, copy);
+    zmemcpy(dest + copy, state->window, len - copy);
+}
 
-/* check function to use adler32() for zlib or crc32() for gzip */
-#ifdef GUNZIP
-#  define UPDATE(check, buf, len) \
-    (state->flags ? crc32(check, buf, len) : adler32(check, buf, len))
-#else
-#  define UPDATE(check, buf, len) adler32(check, buf, len)
+/*
+   Build the length/literal and distance code tables at state->next for the
+   nlen + ndist code lengths in state->lens[].  If the lengths do not make
+   valid codes, set strm->msg, put inflate in the BAD mode, and return true.
+ */
+local int codetables(strm)
+z_streamp strm;
+{
+    struct inflate_state FAR *state;
+
+    /* note: the root table sizes are set with ROOT_LENBITS and ROOT_DISTBITS
+       in inftrees.h, where the ENOUGH constants that depend on those values
+       are */
+    state = (struct inflate_state FAR *)strm->state;
+    state->lencode = (const code FAR *)(state->next);
+    state->lenbits = ROOT_LENBITS;
+    if (inflate_table(LENS, state->lens, state->nlen, &(state->next),
+                      &(state->lenbits), state->work)) {
+        strm->msg = (char *)"invalid literal/lengths set";
+        state->mode = BAD;
+        return 1;
+    }
+#ifndef ASMINF
+    inflate_pairs((code FAR *)(state->lencode), state->lenbits);
 #endif
+    state->distcode = (const code FAR *)(state->next);
+    state->distbits = ROOT_DISTBITS;
+    if (inflate_table(DISTS, state->lens + state->nlen, state->ndist,
+                      &(state->next), &(state->distbits), state->work)) {
+        strm->msg = (char *)"invalid distances set";
+        state->mode = BAD;
+        return 1;
+    }
+    return 0;
+}
+
+#if INFLATE_CACHE
+/*
+   Dynamic block tables are kept for reuse by the code lengths they were built
+   from.  A lookup is by a hash of the code lengths, confirmed by comparing the
+   lengths.  A set of tables is only kept once its code lengths have been seen
+   in an earlier header, which is noted in a short list of hashes.  Then the
+   tables are built in a kept slot instead of in state->codes, replacing the
+   least recently used slot if they are all allocated.  If a slot can't be
+   allocated, the tables are just built in state->codes as usual.
+ */
+local unsigned long cachekey(state)
+struct inflate_state FAR *state;
+{
+    unsigned long key;
+    unsigned n;
+
+    key = state->nlen + ((unsigned long)state->ndist << 9);
+    for (n = 0; n < state->nlen + state->ndist; n++)
+        key = ((key << 5) + key + state->lens[n]) & 0xffffffffUL;
+    return key;
+}
+
+/* Return the kept tables for the code lengths in state->lens, or Z_NULL. */
+local struct inflate_slot FAR *cachefind(state, key)
+struct inflate_state FAR *state;
+unsigned long key;
+{
+    struct inflate_slot FAR *slot;
+    unsigned k, n;
+
+    for (k = 0; k < INFLATE_CACHE; k++) {
+        slot = state->slot[k];
+        if (slot == Z_NULL)
+            break;
+        if (slot->key != key || slot->nlen != state->nlen ||
+            slot->ndist != state->ndist)
+            continue;
+        for (n = 0; n < state->nlen + state->ndist; n++)
+            if (slot->lens[n] != state->lens[n])
+                break;
+        if (n == state->nlen + state->ndist) {
+            slot->use = ++state->uses;
+            return slot;
+        }
+    }
+    return Z_NULL;
+}
+
+/* Return the slot to build the tables in to keep them, or Z_NULL to build
+   them in state->codes. */
+local struct inflate_slot FAR *cacheslot(strm, key)
+z_streamp strm;
+unsigned long key;
+{
+    struct inflate_state FAR *state;
+    struct inflate_slot FAR *slot;
+    unsigned k;
+
+    /* if not seen before, note it for next time */
+    state = (struct inflate_state FAR *)strm->state;
+    for (k = 0; k < INFLATE_CACHE; k++)
+        if (state->seen[k] == key)
+            break;
+    if (k == INFLATE_CACHE) {
+        state->seen[state->nseen] = key;
+        state->nseen = (state->nseen + 1) % INFLATE_CACHE;
+        return Z_NULL;
+    }
+    state->seen[k] = 0;
+
+    /* use a new slot, or else the least recently used one */
+    for (k = 0; k < INFLATE_CACHE; k++)
+        if (state->slot[k] == Z_NULL)
+            break;
+    if (k < INFLATE_CACHE) {
+        slot = (struct inflate_slot FAR *)
+               ZALLOC(strm, 1, sizeof(struct inflate_slot));
+        if (slot == Z_NULL)
+            return Z_NULL;
+        state->slot[k] = slot;
+    }
+    else {
+        slot = state->slot[0];
+        for (k = 1; k < INFLATE_CACHE; k++)
+            if (state->slot[k]->use < slot->use)
+                slot = state->slot[k];
+    }
+    slot->key = key;
+    slot->nlen = 0;                     /* not usable until built */
+    return slot;
+}
+
+/* Mark the tables just built in slot as usable for later headers. */
+local void cachekeep(state, slot)
+struct inflate_state FAR *state;
+struct inflate_slot FAR *slot;
+{
+    unsigned n;
+
+    slot->use = ++state->uses;
+    slot->nlen = state->nlen;
+    slot->ndist = state->ndist;
+    slot->lenbits = state->lenbits;
+    slot->distbits = state->distbits;
+    slot->dist = (unsigned)(state->distcode - slot->codes);
+    for (n = 0; n < state->nlen + state->ndist; n++)
+        slot->lens[n] = (unsigned char)(state->lens[n]);
+    state->next = state->codes;
+}
+#endif /* INFLATE_CACHE */
+
+/* Macros for inflate(): */
 
 /* check macros for header crc */
 #ifdef GUNZIP
@@ -618,12 +874,16 @@ int flush;
     code here;                  /* current decoding table entry */
     code last;                  /* parent table entry */
     unsigned len;               /* length to copy for repeats, bits to drop */
+    unsigned cut;               /* output space held back to keep the window */
+    int inring;                 /* true if writing in place in a ring buffer */
     int ret;                    /* return code */
 #ifdef GUNZIP
     unsigned char hbuf[4];      /* buffer for gzip header crc calculation */
 #endif
-    static const unsigned short order[19] = /* permutation of code lengths */
-        {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+#if INFLATE_CACHE
+    unsigned long key;          /* hash of dynamic block code lengths */
+    struct inflate_slot FAR *slot;  /* where kept tables are */
+#endif
 
     if (strm == Z_NULL || strm->state == Z_NULL || strm->next_out == Z_NULL ||
         (strm->next_in == Z_NULL && strm->avail_in != 0))
@@ -632,6 +892,20 @@ int flush;
     state = (struct inflate_state FAR *)strm->state;
     if (state->mode == TYPE) state->mode = TYPEDO;      /* skip check */
     LOAD();
+
+    /* output written in place in a ring buffer from inflateRing() is the
+       window, so it must not reach the end of the ring or the history */
+    cut = 0;
+    inring = state->ring && put == state->window + state->wnext;
+    if (inring) {
+        copy = state->wsize - state->wnext;
+        if (copy > state->ring)
+            copy = state->ring;
+        if (left > copy) {
+            cut = left - copy;
+            left = copy;
+        }
+    }
     in = have;
     out = left;
     ret = Z_OK;
@@ -699,14 +973,16 @@ int flush;
             }
             if (state->head != Z_NULL)
                 state->head->text = (int)((hold >> 8) & 1);
-            if (state->flags & 0x0200) CRC2(state->check, hold);
+            if ((state->flags & 0x0200) && (state->wrap & 4))
+                CRC2(state->check, hold);
             INITBITS();
             state->mode = TIME;
         case TIME:
             NEEDBITS(32);
             if (state->head != Z_NULL)
                 state->head->time = hold;
-            if (state->flags & 0x0200) CRC4(state->check, hold);
+            if ((state->flags & 0x0200) && (state->wrap & 4))
+                CRC4(state->check, hold);
             INITBITS();
             state->mode = OS;
         case OS:
@@ -715,7 +991,8 @@ int flush;
                 state->head->xflags = (int)(hold & 0xff);
                 state->head->os = (int)(hold >> 8);
             }
-            if (state->flags & 0x0200) CRC2(state->check, hold);
+            if ((state->flags & 0x0200) && (state->wrap & 4))
+                CRC2(state->check, hold);
             INITBITS();
             state->mode = EXLEN;
         case EXLEN:
@@ -724,7 +1001,8 @@ int flush;
                 state->length = (unsigned)(hold);
                 if (state->head != Z_NULL)
                     state->head->extra_len = (unsigned)hold;
-                if (state->flags & 0x0200) CRC2(state->check, hold);
+                if ((state->flags & 0x0200) && (state->wrap & 4))
+                    CRC2(state->check, hold);
                 INITBITS();
             }
             else if (state->head != Z_NULL)
@@ -743,7 +1021,7 @@ int flush;
                                 len + copy > state->head->extra_max ?
                                 state->head->extra_max - len : copy);
                     }
-                    if (state->flags & 0x0200)
+                    if ((state->flags & 0x0200) && (state->wrap & 4))
                         state->check = crc32(state->check, next, copy);
                     have -= copy;
                     next += copy;
@@ -764,7 +1042,7 @@ int flush;
                             state->length < state->head->name_max)
                         state->head->name[state->length++] = len;
                 } while (len && copy < have);
-                if (state->flags & 0x0200)
+                if ((state->flags & 0x0200) && (state->wrap & 4))
                     state->check = crc32(state->check, next, copy);
                 have -= copy;
                 next += copy;
@@ -785,7 +1063,7 @@ int flush;
                             state->length < state->head->comm_max)
                         state->head->comment[state->length++] = len;
                 } while (len && copy < have);
-                if (state->flags & 0x0200)
+                if ((state->flags & 0x0200) && (state->wrap & 4))
                     state->check = crc32(state->check, next, copy);
                 have -= copy;
                 next += copy;
@@ -797,7 +1075,7 @@ int flush;
         case HCRC:
             if (state->flags & 0x0200) {
                 NEEDBITS(16);
-                if (hold != (state->check & 0xffff)) {
+                if ((state->wrap & 4) && hold != (state->check & 0xffff)) {
                     strm->msg = (char *)"header crc mismatch";
                     state->mode = BAD;
                     break;
@@ -992,28 +1270,32 @@ int flush;
                 break;
             }
 
-            /* build code tables -- note: do not change the lenbits or distbits
-               values here (9 and 6) without reading the comments in inftrees.h
-               concerning the ENOUGH constants, which depend on those values */
-            state->next = state->codes;
-            state->lencode = (const code FAR *)(state->next);
-            state->lenbits = 9;
-            ret = inflate_table(LENS, state->lens, state->nlen, &(state->next),
-                                &(state->lenbits), state->work);
-            if (ret) {
-                strm->msg = (char *)"invalid literal/lengths set";
-                state->mode = BAD;
-                break;
-            }
-            state->distcode = (const code FAR *)(state->next);
-            state->distbits = 6;
-            ret = inflate_table(DISTS, state->lens + state->nlen, state->ndist,
-                            &(state->next), &(state->distbits), state->work);
-            if (ret) {
-                strm->msg = (char *)"invalid distances set";
-                state->mode = BAD;
+#if INFLATE_CACHE
+            /* use tables already built for the same code lengths */
+            key = cachekey(state);
+            slot = cachefind(state, key);
+            if (slot != Z_NULL) {
+                state->lencode = (const code FAR *)(slot->codes);
+                state->lenbits = slot->lenbits;
+                state->distcode = (const code FAR *)(slot->codes + slot->dist);
+                state->distbits = slot->distbits;
+                Tracev((stderr, "inflate:       codes reused\n"));
+                state->mode = LEN_;
+                if (flush == Z_TREES) goto inf_leave;
                 break;
             }
+            slot = cacheslot(strm, key);
+            state->next = slot == Z_NULL ? state->codes : slot->codes;
+#else
+            state->next = state->codes;
+#endif
+
+            /* build code tables */
+            if (codetables(strm)) break;
+#if INFLATE_CACHE
+            if (slot != Z_NULL)
+                cachekeep(state, slot);
+#endif
             Tracev((stderr, "inflate:       codes ok\n"));
             state->mode = LEN_;
             if (flush == Z_TREES) goto inf_leave;
@@ -1028,9 +1310,22 @@ int flush;
                     state->back = -1;
                 break;
             }
+            RESTORE();
+            inflate_small(strm, out);
+            LOAD();
+            if (state->mode != LEN) {
+                if (state->mode == TYPE)
+                    state->back = -1;
+                break;
+            }
             state->back = 0;
             for (;;) {
                 here = state->lencode[BITS(state->lenbits)];
+                if (here.op & 128) {    /* just the first of two literals */
+                    here.bits = (unsigned char)(here.op & 15);
+                    here.op = 0;
+                    here.val &= 0xff;
+                }
                 if ((unsigned)(here.bits) <= bits) break;
                 PULLBYTE();
             }
@@ -1178,11 +1473,11 @@ int flush;
                 out -= left;
                 strm->total_out += out;
                 state->total += out;
-                if (out)
+                if ((state->wrap & 4) && out)
                     strm->adler = state->check =
                         UPDATE(state->check, put - out, out);
                 out = left;
-                if ((
+                if ((state->wrap & 4) && (
 #ifdef GUNZIP
                      state->flags ? hold :
 #endif
@@ -1225,25 +1520,43 @@ int flush;
     /*
        Return from inflate(), updating the total counts and the check value.
        If there was no progress during the inflate() call, return a buffer
-       error.  Call updatewindow() to create and/or update the window state.
+       error.  Call updatewindow() to create and/or update the window state,
+       which also updates the check value while copying to the window.
+       Output written in place in a ring buffer is already in the window.
+       A dictionary from inflateUseDictionary() is left in place when it is
+       not needed, as when a window would not be created for Z_FINISH.
        Note: a memory error from inflate() is non-recoverable.
      */
   inf_leave:
     RESTORE();
-    if (state->wsize || (out != strm->avail_out && state->mode < BAD &&
-            (state->mode < CHECK || flush != Z_FINISH)))
-        if (updatewindow(strm, strm->next_out, out - strm->avail_out)) {
+    in -= strm->avail_in;
+    out -= strm->avail_out;
+    strm->avail_out += cut;
+    if (inring) {
+        if ((state->wrap & 4) && out)
+            state->check = UPDATE(state->check, strm->next_out - out, out);
+        state->wnext += out;
+        if (state->wnext == state->wsize)
+            state->wnext = 0;
+        state->whave = state->whave < state->wsize - out ?
+                       state->whave + out : state->wsize;
+    }
+    else if ((state->wsize && !state->shared) ||
+            (out && state->mode < BAD &&
+             (state->mode < CHECK || flush != Z_FINISH))) {
+        if (updatewindow(strm, strm->next_out, out,
+                         (state->wrap & 4) && out)) {
             state->mode = MEM;
             return Z_MEM_ERROR;
         }
-    in -= strm->avail_in;
-    out -= strm->avail_out;
+    }
+    else if ((state->wrap & 4) && out)
+        state->check = UPDATE(state->check, strm->next_out - out, out);
     strm->total_in += in;
     strm->total_out += out;
     state->total += out;
-    if (state->wrap && out)
-        strm->adler = state->check =
-            UPDATE(state->check, strm->next_out - out, out);
+    if ((state->wrap & 4) && out)
+        strm->adler = state->check;
     strm->data_type = state->bits + (state->last ? 64 : 0) +
                       (state->mode == TYPE ? 128 : 0) +
                       (state->mode == LEN_ || state->mode == COPY_ ? 256 : 0);
@@ -1252,6 +1565,133 @@ int flush;
     return ret;
 }
 
+int ZEXPORT inflateV(strm, in, nin, out, nout, flush)
+z_streamp strm;
+z_vecp in;
+unsigned nin;
+z_vecp out;
+unsigned nout;
+int flush;
+{
+    unsigned i = 0, o = 0, next;
+    int last, ret = Z_BUF_ERROR;
+
+    if (strm == Z_NULL || strm->state == Z_NULL ||
+        (in == Z_NULL && nin) || (out == Z_NULL && nout))
+        return Z_STREAM_ERROR;
+
+    /* call inflate() on each pair of input and output segments -- Z_FINISH
+       is only passed with the last input and output segments, since inflate()
+       would otherwise return Z_BUF_ERROR when a segment runs out */
+    for (;;) {
+        while (i < nin && in[i].len == 0)
+            i++;
+        while (o < nout && out[o].len == 0)
+            o++;
+        if (o == nout)
+            break;
+        next = i + 1;
+        while (next < nin && in[next].len == 0)
+            next++;
+        last = next >= nin;
+        strm->next_in = i < nin ? in[i].base : Z_NULL;
+        strm->avail_in = i < nin ? in[i].len : 0;
+        strm->next_out = out[o].base;
+        strm->avail_out = out[o].len;
+        next = o + 1;
+        while (next < nout && out[next].len == 0)
+            next++;
+        ret = inflate(strm, flush != Z_FINISH || (last && next >= nout) ?
+                            flush : Z_NO_FLUSH);
+        if (i < nin) {
+            in[i].base = (Bytef *)strm->next_in;
+            in[i].len = strm->avail_in;
+        }
+        out[o].base = strm->next_out;
+        out[o].len = strm->avail_out;
+
+        /* stop if inflate() left output space with input left over, which
+           happens at the end of the stream or at a block boundary for
+           Z_BLOCK, or if the input is used up */
+        if (ret != Z_OK || (strm->avail_out != 0 &&
+                            (strm->avail_in != 0 || last)))
+            break;
+    }
+    if (flush == Z_FINISH && ret == Z_OK)
+        ret = Z_BUF_ERROR;
+    return ret;
+}
+
+int ZEXPORT inflateBatch(strm, dictionary, dictLength, dest, destLen, source,
+                         sourceLen, status, n)
+z_streamp strm;
+const Bytef *dictionary;
+uInt dictLength;
+Bytef * const *dest;
+uLongf *destLen;
+const Bytef * const *source;
+const uLong *sourceLen;
+int *status;
+unsigned n;
+{
+    struct inflate_state FAR *state;
+    unsigned i;
+    int ret, err = Z_OK;
+
+    if (strm == Z_NULL || strm->state == Z_NULL || (n &&
+        (dest == Z_NULL || destLen == Z_NULL || source == Z_NULL ||
+         sourceLen == Z_NULL)))
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+
+    /* decode each record with one call of inflate(), so that no window is
+       allocated if the records fit -- the dictionary is used in place */
+    for (i = 0; i < n; i++) {
+        ret = inflateReset(strm);
+        if (ret != Z_OK)
+            return ret;
+        strm->next_in = (z_const Bytef *)source[i];
+        strm->avail_in = (uInt)sourceLen[i];
+        strm->next_out = dest[i];
+        strm->avail_out = (uInt)destLen[i];
+        if ((uLong)strm->avail_in != sourceLen[i] ||
+            (uLong)strm->avail_out != destLen[i])
+            ret = Z_BUF_ERROR;
+        else {
+            if (dictionary != Z_NULL && state->wrap == 0)
+                inflateUseDictionary(strm, dictionary, dictLength);
+            ret = inflate(strm, Z_FINISH);
+            if (ret == Z_NEED_DICT && dictionary != Z_NULL) {
+                ret = inflateUseDictionary(strm, dictionary, dictLength);
+                if (ret == Z_OK)
+                    ret = inflate(strm, Z_FINISH);
+            }
+        }
+
+        /* report as uncompress() would */
+        if (ret == Z_MEM_ERROR || ret == Z_STREAM_ERROR)
+            return ret;
+        if (ret == Z_STREAM_END) {
+            destLen[i] = strm->total_out;
+            ret = Z_OK;
+        }
+        else {
+            destLen[i] = 0;
+            if (ret == Z_NEED_DICT ||
+                (ret == Z_BUF_ERROR && strm->avail_in == 0))
+                ret = Z_DATA_ERROR;
+            if (err == Z_OK)
+                err = ret;
+        }
+        if (status != Z_NULL)
+            status[i] = ret;
+    }
+
+    /* drop the reference to the dictionary */
+    ret = inflateReset(strm);
+    return ret == Z_OK ? err : ret;
+}
+
 int ZEXPORT inflateEnd(strm)
 z_streamp strm;
 {
@@ -1259,7 +1699,16 @@ z_streamp strm;
     if (strm == Z_NULL || strm->state == Z_NULL || strm->zfree == (free_func)0)
         return Z_STREAM_ERROR;
     state = (struct inflate_state FAR *)strm->state;
+    if (state->shared) state->window = state->wsave;
     if (state->window != Z_NULL) ZFREE(strm, state->window);
+#if INFLATE_CACHE
+    {
+        unsigned k;
+
+        for (k = 0; k < INFLATE_CACHE && state->slot[k] != Z_NULL; k++)
+            ZFREE(strm, state->slot[k]);
+    }
+#endif
     ZFREE(strm, strm->state);
     strm->state = Z_NULL;
     Tracev((stderr, "inflate: end\n"));
@@ -1272,20 +1721,20 @@ Bytef *dictionary;
 uInt *dictLength;
 {
     struct inflate_state FAR *state;
+    unsigned len;
 
     /* check state */
     if (strm == Z_NULL || strm->state == Z_NULL) return Z_STREAM_ERROR;
     state = (struct inflate_state FAR *)strm->state;
 
-    /* copy dictionary */
-    if (state->whave && dictionary != Z_NULL) {
-        zmemcpy(dictionary, state->window + state->wnext,
-                state->whave - state->wnext);
-        zmemcpy(dictionary + state->whave - state->wnext,
-                state->window, state->wnext);
-    }
+    /* copy dictionary, at most a window's worth from a ring buffer */
+    len = state->whave;
+    if (state->ring && len > (1U << state->wbits))
+        len = 1U << state->wbits;
+    if (len && dictionary != Z_NULL)
+        windowlast(state, dictionary, len);
     if (dictLength != Z_NULL)
-        *dictLength = state->whave;
+        *dictLength = len;
     return Z_OK;
 }
 
@@ -1314,7 +1763,7 @@ uInt dictLength;
 
     /* copy dictionary to window using updatewindow(), which will amend the
        existing dictionary if appropriate */
-    ret = updatewindow(strm, dictionary + dictLength, dictLength);
+    ret = updatewindow(strm, dictionary + dictLength, dictLength, 0);
     if (ret) {
         state->mode = MEM;
         return Z_MEM_ERROR;
@@ -1324,6 +1773,78 @@ uInt dictLength;
     return Z_OK;
 }
 
+int ZEXPORT inflateUseDictionary(strm, dictionary, dictLength)
+z_streamp strm;
+const Bytef *dictionary;
+uInt dictLength;
+{
+    struct inflate_state FAR *state;
+    unsigned long dictid;
+
+    /* check state -- nothing decoded yet, or a dictionary was asked for */
+    if (strm == Z_NULL || strm->state == Z_NULL || dictionary == Z_NULL)
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+    if (state->ring || (state->wrap != 0 ? state->mode != DICT :
+                            state->mode != HEAD || state->wsize != 0))
+        return Z_STREAM_ERROR;
+
+    /* check for correct dictionary identifier */
+    if (state->mode == DICT) {
+        dictid = adler32(0L, Z_NULL, 0);
+        dictid = adler32(dictid, dictionary, dictLength);
+        if (dictid != state->check)
+            return Z_DATA_ERROR;
+    }
+
+    /* use the tail of the dictionary in place as a full window with no
+       wrap, until updatewindow() needs to write to the window */
+    if (dictLength > (1U << state->wbits)) {
+        dictionary += dictLength - (1U << state->wbits);
+        dictLength = 1U << state->wbits;
+    }
+    if (dictLength) {
+        if (!state->shared) {
+            state->wsave = state->window;
+            state->shared = 1;
+        }
+        state->window = (unsigned char FAR *)dictionary;
+        state->wsize = dictLength;
+        state->whave = dictLength;
+        state->wnext = 0;
+    }
+    state->havedict = 1;
+    Tracev((stderr, "inflate:   dictionary referenced\n"));
+    return Z_OK;
+}
+
+int ZEXPORT inflateRing(strm, ring, size)
+z_streamp strm;
+Bytef *ring;
+unsigned size;
+{
+    struct inflate_state FAR *state;
+    unsigned max;
+
+    /* check state -- nothing decoded yet, and room for the window and more */
+    if (strm == Z_NULL || strm->state == Z_NULL || ring == Z_NULL)
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+    max = 1U << (state->wbits ? state->wbits : 15);
+    if (state->mode != HEAD || state->wsize != 0 || state->shared ||
+        size <= max)
+        return Z_STREAM_ERROR;
+
+    /* use the ring as an empty window, which output in place then fills */
+    state->wsave = state->window;
+    state->shared = 1;
+    state->window = (unsigned char FAR *)ring;
+    state->wsize = size;
+    state->ring = size - max;
+    Tracev((stderr, "inflate:   ring buffer referenced\n"));
+    return Z_OK;
+}
+
 int ZEXPORT inflateGetHeader(strm, head)
 z_streamp strm;
 gz_headerp head;
@@ -1351,6 +1872,12 @@ gz_headerp head;
    yet and the return value is len.  In the latter case, syncsearch() can be
    called again with more data and the *have state.  *have is initialized to
    zero for the first call.
+
+   Only a pattern carried over from the last call needs to be followed a byte
+   at a time, which takes at most three bytes.  After that, zmemchr() is used
+   to skip to each 0xff that could be the third byte of a pattern, and the
+   bytes around it are checked.  The state for the next call depends only on
+   the last three bytes.
  */
 local unsigned syncsearch(have, buf, len)
 unsigned FAR *have;
@@ -1359,10 +1886,12 @@ unsigned len;
 {
     unsigned got;
     unsigned next;
+    const unsigned char FAR *ff;
 
+    /* continue a pattern from the last call, if any */
     got = *have;
     next = 0;
-    while (next < len && got < 4) {
+    while (next < len && next < 3 && got < 4) {
         if ((int)(buf[next]) == (got < 2 ? 0 : 0xff))
             got++;
         else if (buf[next])
@@ -1371,6 +1900,30 @@ unsigned len;
             got = 4 - got;
         next++;
     }
+
+    /* look for a pattern entirely in buf */
+    if (got < 4 && next < len) {
+        ff = buf + 2;
+        while ((ff = (const unsigned char FAR *)zmemchr(ff, 0xff,
+                        (uInt)(len - 1 - (unsigned)(ff - buf)))) != Z_NULL) {
+            if (ff[1] == 0xff && ff[-1] == 0 && ff[-2] == 0) {
+                *have = 4;
+                return (unsigned)(ff - buf) + 2;
+            }
+            if (++ff == buf + len - 1)
+                break;
+        }
+
+        /* not found -- get the state from the last three bytes */
+        got = 0;
+        for (next = len - 3; next < len; next++)
+            if ((int)(buf[next]) == (got < 2 ? 0 : 0xff))
+                got++;
+            else if (buf[next])
+                got = 0;
+            else
+                got = 4 - got;
+    }
     *have = got;
     return next;
 }
@@ -1418,6 +1971,16 @@ z_streamp strm;
     return Z_OK;
 }
 
+uInt ZEXPORT inflateSyncFind(buf, len, have)
+const Bytef *buf;
+uInt len;
+unsigned *have;
+{
+    if (have == Z_NULL || len == 0) return 0;
+    if (*have > 3) *have = 0;
+    return syncsearch(have, buf, len);
+}
+
 /*
    Returns true if inflate is currently at the end of a block generated by
    Z_SYNC_FLUSH or Z_FULL_FLUSH. This function is used by one PPP
@@ -1456,7 +2019,7 @@ z_streamp source;
            ZALLOC(source, 1, sizeof(struct inflate_state));
     if (copy == Z_NULL) return Z_MEM_ERROR;
     window = Z_NULL;
-    if (state->window != Z_NULL) {
+    if (state->window != Z_NULL && !state->shared) {
         window = (unsigned char FAR *)
                  ZALLOC(source, 1U << state->wbits, sizeof(unsigned char));
         if (window == Z_NULL) {
@@ -1473,16 +2036,311 @@ z_streamp source;
         copy->lencode = copy->codes + (state->lencode - state->codes);
         copy->distcode = copy->codes + (state->distcode - state->codes);
     }
+#if INFLATE_CACHE
+    {
+        /* the copy keeps no tables -- copy the kept ones in use, if any */
+        unsigned k;
+
+        for (k = 0; k < INFLATE_CACHE; k++) {
+            if (state->slot[k] != Z_NULL &&
+                state->lencode == state->slot[k]->codes) {
+                zmemcpy((voidpf)copy->codes, (voidpf)state->slot[k]->codes,
+                        sizeof(copy->codes));
+                copy->lencode = copy->codes;
+                copy->distcode = copy->codes + state->slot[k]->dist;
+            }
+            copy->slot[k] = Z_NULL;
+        }
+    }
+#endif
     copy->next = copy->codes + (state->next - state->codes);
-    if (window != Z_NULL) {
-        wsize = 1U << state->wbits;
-        zmemcpy(window, state->window, wsize);
+    if (state->shared)          /* refer to the same dictionary or ring */
+        copy->wsave = Z_NULL;
+    else {
+        if (window != Z_NULL) {
+            wsize = 1U << state->wbits;
+            zmemcpy(window, state->window, wsize);
+        }
+        copy->window = window;
     }
-    copy->window = window;
     dest->state = (struct internal_state FAR *)copy;
     return Z_OK;
 }
 
+/* inflateSave() checkpoint version, and what code tables it says are in use */
+#define SAVE_VERSION 1
+#define SAVE_NONE 0         /* no code tables */
+#define SAVE_FIXED 1        /* fixed tables */
+#define SAVE_DYNAMIC 2      /* tables for the nlen + ndist code lengths */
+#define SAVE_CODES 3        /* code length code table, 19 more lengths */
+
+/* bytes in a checkpoint besides the code lengths and the window: five header
+   bytes, 22 four-byte and three eight-byte fields, and the Adler-32 check */
+#define SAVE_SIZE (5 + 22 * 4 + 3 * 8 + 4)
+
+int ZEXPORT inflateSave(strm, buf, len)
+z_streamp strm;
+unsigned char FAR *buf;
+unsigned long FAR *len;
+{
+    struct inflate_state FAR *state;
+    unsigned char FAR *next;
+    unsigned kind, nlens, whave, copy;
+    unsigned long need;
+    code here;
+
+    /* check state */
+    if (strm == Z_NULL || strm->state == Z_NULL || len == Z_NULL)
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+    if (state->mode == BAD || state->mode == MEM)
+        return Z_STREAM_ERROR;
+
+    /* the tables are saved as the code lengths they were built from */
+    kind = SAVE_NONE;
+    nlens = 0;
+    if (state->mode == LENLENS)
+        nlens = state->have;
+    else if (state->mode == CODELENS) {
+        kind = SAVE_CODES;
+        nlens = state->have;
+    }
+    else if (state->mode >= LEN_ && state->mode <= LIT) {
+        kind = SAVE_FIXED;
+        if (state->lencode >= state->codes &&
+            state->lencode <= state->codes + ENOUGH - 1)
+            kind = SAVE_DYNAMIC;
+#if INFLATE_CACHE
+        for (copy = 0; copy < INFLATE_CACHE; copy++)
+            if (state->slot[copy] != Z_NULL &&
+                state->lencode == state->slot[copy]->codes)
+                kind = SAVE_DYNAMIC;
+#endif
+        if (kind == SAVE_DYNAMIC)
+            nlens = state->nlen + state->ndist;
+    }
+    whave = state->whave;
+    if (state->ring && whave > (1U << state->wbits))
+        whave = 1U << state->wbits;
+    need = SAVE_SIZE + nlens + (kind == SAVE_CODES ? 19 : 0) + whave;
+    if (buf == Z_NULL || *len < need) {
+        *len = need;
+        return buf == Z_NULL ? Z_OK : Z_BUF_ERROR;
+    }
+
+    /* header and state */
+    next = buf;
+    *next++ = 'z';
+    *next++ = 'i';
+    *next++ = SAVE_VERSION;
+    *next++ = (unsigned char)(state->mode);
+    *next++ = (unsigned char)kind;
+    next = zputbe(next, (unsigned long)(state->last), 4);
+    next = zputbe(next, (unsigned long)(state->wrap), 4);
+    next = zputbe(next, (unsigned long)(state->havedict), 4);
+    next = zputbe(next, (unsigned long)(state->flags), 4);
+    next = zputbe(next, state->dmax, 4);
+    next = zputbe(next, state->check, 4);
+    next = zputbe(next, state->wbits, 4);
+    next = zputbe(next, whave, 4);
+    next = zputbe(next, state->hold, 4);
+    next = zputbe(next, state->bits, 4);
+    next = zputbe(next, state->length, 4);
+    next = zputbe(next, state->offset, 4);
+    next = zputbe(next, state->extra, 4);
+    if (state->mode == TABLE)           /* not read from the block yet */
+        next = zputbe(next, 0, 12);
+    else {
+        next = zputbe(next, state->ncode, 4);
+        next = zputbe(next, state->nlen, 4);
+        next = zputbe(next, state->ndist, 4);
+    }
+    next = zputbe(next, state->have, 4);
+    next = zputbe(next, (unsigned long)(state->sane), 4);
+    next = zputbe(next, (unsigned long)(state->back + 1), 4);
+    next = zputbe(next, state->was, 4);
+    next = zputbe(next, strm->adler, 4);
+    next = zputbe(next, state->total, 8);
+    next = zputbe(next, strm->total_in, 8);
+    next = zputbe(next, strm->total_out, 8);
+
+    /* code lengths, and for SAVE_CODES the lengths of the code length code,
+       which are in its table (complete, so every used symbol is there) */
+    next = zputbe(next, nlens, 4);
+    for (copy = 0; copy < nlens; copy++)
+        *next++ = (unsigned char)(state->lens[state->mode == LENLENS ?
+                                              order[copy] : copy]);
+    if (kind == SAVE_CODES) {
+        zmemzero(next, 19);
+        for (copy = 0; copy < (1U << state->lenbits); copy++) {
+            here = state->lencode[copy];
+            next[here.val] = here.bits;
+        }
+        next += 19;
+    }
+
+    /* window contents, oldest first */
+    if (whave) {
+        windowlast(state, next, whave);
+        next += whave;
+    }
+
+    /* check value of all of the above */
+    next = zputbe(next, adler32(1L, buf, (uInt)(next - buf)), 4);
+    Assert((unsigned long)(next - buf) == need, "inflateSave size mismatch");
+    *len = need;
+    return Z_OK;
+}
+
+int ZEXPORT inflateRestore(strm, buf, len)
+z_streamp strm;
+const unsigned char FAR *buf;
+unsigned long len;
+{
+    struct inflate_state FAR *state;
+    const unsigned char FAR *next;
+    unsigned mode, kind, want, nlens, wbits, whave, copy;
+    unsigned short cl[19];
+    code FAR *codes;
+
+    /* check state and checkpoint */
+    if (strm == Z_NULL || strm->state == Z_NULL || buf == Z_NULL)
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state FAR *)strm->state;
+    if (len < SAVE_SIZE || len > SAVE_SIZE + 320 + 19 + 32768U ||
+        buf[0] != 'z' || buf[1] != 'i' || buf[2] != SAVE_VERSION)
+        goto bad;
+    next = buf + len - 4;
+    if (zgetbe(&next, 4) != adler32(1L, buf, (uInt)(len - 4)))
+        goto bad;
+    mode = buf[3];
+    kind = buf[4];
+    if (mode > SYNC || mode == BAD || mode == MEM)
+        goto bad;
+    want = mode == CODELENS ? SAVE_CODES :
+           (mode >= LEN_ && mode <= LIT ? SAVE_DYNAMIC : SAVE_NONE);
+    if (kind != want && (kind != SAVE_FIXED || want != SAVE_DYNAMIC))
+        goto bad;
+
+    /* state */
+    next = buf + 5;
+    state->last = (int)zgetbe(&next, 4);
+    state->wrap = (int)zgetbe(&next, 4);
+    state->havedict = (int)zgetbe(&next, 4);
+    state->flags = (int)zgetbe(&next, 4);
+    state->dmax = (unsigned)zgetbe(&next, 4);
+    state->check = zgetbe(&next, 4);
+    wbits = (unsigned)zgetbe(&next, 4);
+    whave = (unsigned)zgetbe(&next, 4);
+    state->hold = zgetbe(&next, 4);
+    state->bits = (unsigned)zgetbe(&next, 4);
+    state->length = (unsigned)zgetbe(&next, 4);
+    state->offset = (unsigned)zgetbe(&next, 4);
+    state->extra = (unsigned)zgetbe(&next, 4);
+    state->ncode = (unsigned)zgetbe(&next, 4);
+    state->nlen = (unsigned)zgetbe(&next, 4);
+    state->ndist = (unsigned)zgetbe(&next, 4);
+    state->have = (unsigned)zgetbe(&next, 4);
+    state->sane = zgetbe(&next, 4) != 0;
+#ifndef INFLATE_ALLOW_INVALID_DISTANCE_TOOFAR_ARRR
+    state->sane = 1;
+#endif
+    state->back = (int)zgetbe(&next, 4) - 1;
+    state->was = (unsigned)zgetbe(&next, 4);
+    strm->adler = zgetbe(&next, 4);
+    state->total = zgetbe(&next, 8);
+    strm->total_in = zgetbe(&next, 8);
+    strm->total_out = zgetbe(&next, 8);
+    nlens = (unsigned)zgetbe(&next, 4);
+    if (wbits > 15 || whave > (1U << wbits) || state->bits > 32)
+        goto bad;
+    if (state->bits < 32)
+        state->hold &= (1UL << state->bits) - 1;
+
+    /* check what the mode uses -- the rest may never have been set */
+    if (((mode == LENEXT || mode == DISTEXT) && state->extra > 15) ||
+        (mode == SYNC && state->have > 4) ||
+        (mode == LENLENS && (state->ncode > 19 ||
+                             state->have > state->ncode)) ||
+        (((mode >= TABLE && mode <= CODELENS) || kind == SAVE_DYNAMIC) &&
+         (state->nlen > 286 || state->ndist > 30)) ||
+        (mode == CODELENS && state->have > state->nlen + state->ndist))
+        goto bad;
+    want = mode == LENLENS || kind == SAVE_CODES ? state->have :
+           (kind == SAVE_DYNAMIC ? state->nlen + state->ndist : 0);
+    if (nlens != want ||
+        len != SAVE_SIZE + nlens + (kind == SAVE_CODES ? 19 : 0) + whave)
+        goto bad;
+
+    /* code lengths and code tables */
+    for (copy = 0; copy < nlens; copy++) {
+        if (*next > (mode == LENLENS ? 7 : 15))
+            goto bad;
+        state->lens[mode == LENLENS ? order[copy] : copy] = *next++;
+    }
+    state->next = state->codes;
+    if (kind == SAVE_FIXED)
+        fixedtables(state);
+    else if (kind == SAVE_DYNAMIC) {
+        if (codetables(strm))
+            goto bad;
+    }
+    else if (kind == SAVE_CODES) {
+        for (copy = 0; copy < 19; copy++) {
+            cl[copy] = *next++;
+            if (cl[copy] > 7)
+                goto bad;
+        }
+        codes = state->codes;
+        state->lencode = (const code FAR *)codes;
+        state->lenbits = 7;
+        if (inflate_table(CODES, cl, 19, &codes, &(state->lenbits),
+                          state->work))
+            goto bad;
+        state->next = codes;
+    }
+
+    /* window, reallocated if the size is different */
+    if (state->shared) {
+        state->window = state->wsave;
+        state->shared = 0;
+        state->ring = 0;
+    }
+    if (state->window != Z_NULL && state->wbits != wbits) {
+        ZFREE(strm, state->window);
+        state->window = Z_NULL;
+    }
+    state->wbits = wbits;
+    state->wsize = 0;
+    state->whave = 0;
+    state->wnext = 0;
+    if (whave) {
+        if (state->window == Z_NULL) {
+            state->window = (unsigned char FAR *)
+                            ZALLOC(strm, 1U << wbits, sizeof(unsigned char));
+            if (state->window == Z_NULL) {
+                state->mode = MEM;
+                return Z_MEM_ERROR;
+            }
+        }
+        state->wsize = 1U << wbits;
+        zmemcpy(state->window, next, whave);
+        state->whave = whave;
+        state->wnext = whave == state->wsize ? 0 : whave;
+    }
+
+    /* the gzip header destination is not in the checkpoint */
+    state->head = Z_NULL;
+    state->mode = (inflate_mode)mode;
+    strm->msg = Z_NULL;
+    return Z_OK;
+
+  bad:
+    strm->msg = (char *)"invalid checkpoint";
+    state->mode = BAD;
+    return Z_DATA_ERROR;
+}
+
 int ZEXPORT inflateUndermine(strm, subvert)
 z_streamp strm;
 int subvert;
@@ -77,11 +77,36 @@ typedef enum {
         CHECK -> LENGTH -> DONE
  */
 
+/* Number of sets of dynamic block tables that inflate() keeps, to reuse when
+   a later block header has the same code lengths, as happens in streams from
+   one encoder with many flushes.  Tables are kept only for code lengths that
+   have been seen before, so a stream that does not repeat its headers does
+   not allocate any.  Each set is about 6K bytes.  0 keeps none. */
+#ifndef INFLATE_CACHE
+#  define INFLATE_CACHE 4
+#endif
+
+#if INFLATE_CACHE
+/* dynamic block tables kept for reuse, with the code lengths they are for */
+struct inflate_slot {
+    unsigned long key;          /* hash of the code lengths */
+    unsigned long use;          /* when last used, to replace the oldest */
+    unsigned nlen;              /* number of length code lengths, 0 if unset */
+    unsigned ndist;             /* number of distance code lengths */
+    unsigned lenbits;           /* index bits for the length/literal table */
+    unsigned distbits;          /* index bits for the distance table */
+    unsigned dist;              /* start of the distance table in codes[] */
+    unsigned char lens[320];    /* code lengths, nlen + ndist of them */
+    code codes[ENOUGH];         /* length/literal and distance tables */
+};
+#endif
+
 /* state maintained between inflate() calls.  Approximately 10K bytes. */
 struct inflate_state {
     inflate_mode mode;          /* current inflate mode */
     int last;                   /* true if processing last block */
-    int wrap;                   /* bit 0 true for zlib, bit 1 true for gzip */
+    int wrap;                   /* bit 0 true for zlib, bit 1 true for gzip,
+                                   bit 2 true to validate check value */
     int havedict;               /* true if dictionary provided */
     int flags;                  /* gzip header method and flags (0 if zlib) */
     unsigned dmax;              /* zlib header max distance (INFLATE_STRICT) */
@@ -94,6 +119,11 @@ struct inflate_state {
     unsigned whave;             /* valid bytes in the window */
     unsigned wnext;             /* window write index */
     unsigned char FAR *window;  /* allocated sliding window, if needed */
+    int shared;                 /* true if window is the caller's dictionary
+                                   or ring buffer */
+    unsigned char FAR *wsave;   /* allocated window while shared is true */
+    unsigned ring;              /* if window is the caller's ring buffer, the
+                                   most output one call may write to it */
         /* bit accumulator */
     unsigned long hold;         /* input bit accumulator */
     unsigned bits;              /* number of bits in "in" */
@@ -119,4 +149,11 @@ struct inflate_state {
     int sane;                   /* if false, allow invalid distance too far */
     int back;                   /* bits back of last unprocessed length/lit */
     unsigned was;               /* initial length of match */
+#if INFLATE_CACHE
+        /* dynamic block tables for reuse */
+    struct inflate_slot FAR *slot[INFLATE_CACHE];   /* allocated when needed */
+    unsigned long seen[INFLATE_CACHE];  /* hashes of recent uncached headers */
+    unsigned nseen;             /* next entry of seen[] to replace */
+    unsigned long uses;         /* number of cached tables used or made */
+#endif
 };
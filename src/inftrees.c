@@ -304,3 +304,41 @@ unsigned short FAR *work;
     *bits = root;
     return 0;
 }
+
+/*
+   Combine pairs of literals in the root table of a literal/length code built
+   by inflate_table(), where table is the start of the root table and bits is
+   its index bits.  A root entry for a literal whose code leaves enough of the
+   index bits for the complete code of a second literal is replaced with an
+   entry for both literals.  Its op is 1000llll, where llll is the length of
+   the first code, bits is the length of the two codes, and val is the first
+   literal in the low byte and the second in the high byte.  This lets
+   inflate_fast() write two literals for one table lookup, which is most of
+   the decoding on text.  The other decoders use just the first literal.
+
+   The second code is looked up with the index bits after the first code,
+   which is a lower index in the table.  Going down from the top, that entry
+   has not been replaced yet.
+ */
+void ZLIB_INTERNAL inflate_pairs(table, bits)
+code FAR *table;
+unsigned bits;
+{
+    unsigned sym;               /* index of entry in root table */
+    code here;                  /* entry for first literal */
+    code next;                  /* entry for second literal */
+
+    sym = 1U << bits;
+    while (sym--) {
+        here = table[sym];
+        if (here.op != 0)
+            continue;
+        next = table[sym >> here.bits];
+        if (next.op != 0 || here.bits + next.bits > bits)
+            continue;
+        here.op = (unsigned char)(128 | here.bits);
+        here.bits = (unsigned char)(here.bits + next.bits);
+        here.val = (unsigned short)(here.val | (next.val << 8));
+        table[sym] = here;
+    }
+}
@@ -31,23 +31,62 @@ typedef struct {
     00000000 - literal
     0000tttt - table link, tttt != 0 is the number of table index bits
     0001eeee - length or distance, eeee is the number of extra bits
+    1000llll - two literals, llll is the number of bits in the first code
     01100000 - end of block
     01000000 - invalid code
  */
 
+/* Root table sizes for dynamic blocks, in bits.  Codes longer than the root
+   bits are decoded with a second lookup in a subtable, so larger roots mean
+   fewer second lookups on data with many long codes, at the cost of more
+   table entries to fill for each block header and a larger inflate state.
+   ROOT_LENBITS may be 8..12 and ROOT_DISTBITS 5..10. */
+#ifndef ROOT_LENBITS
+#  define ROOT_LENBITS 9
+#endif
+#ifndef ROOT_DISTBITS
+#  define ROOT_DISTBITS 6
+#endif
+
 /* Maximum size of the dynamic table.  The maximum number of code structures is
-   1444, which is the sum of 852 for literal/length codes and 592 for distance
-   codes.  These values were found by exhaustive searches using the program
-   examples/enough.c found in the zlib distribtution.  The arguments to that
-   program are the number of symbols, the initial root table size, and the
-   maximum bit length of a code.  "enough 286 9 15" for literal/length codes
-   returns returns 852, and "enough 30 6 15" for distance codes returns 592.
-   The initial root table size (9 or 6) is found in the fifth argument of the
-   inflate_table() calls in inflate.c and infback.c.  If the root table size is
-   changed, then these maximum sizes would be need to be recalculated and
-   updated. */
-#define ENOUGH_LENS 852
-#define ENOUGH_DISTS 592
+   1444 for the default root sizes, which is the sum of 852 for literal/length
+   codes and 592 for distance codes.  These values were found by exhaustive
+   searches using the program examples/enough.c found in the zlib
+   distribtution.  The arguments to that program are the number of symbols,
+   the initial root table size, and the maximum bit length of a code.  "enough
+   286 9 15" for literal/length codes returns returns 852, and "enough 30 6 15"
+   for distance codes returns 592.  The values for the other allowed root
+   sizes were found the same way.  The root table size is ROOT_LENBITS or
+   ROOT_DISTBITS, used as the fifth argument of the inflate_table() calls in
+   inflate.c and infback.c. */
+#if ROOT_LENBITS == 8
+#  define ENOUGH_LENS 660
+#elif ROOT_LENBITS == 9
+#  define ENOUGH_LENS 852
+#elif ROOT_LENBITS == 10
+#  define ENOUGH_LENS 1332
+#elif ROOT_LENBITS == 11
+#  define ENOUGH_LENS 2340
+#elif ROOT_LENBITS == 12
+#  define ENOUGH_LENS 4380
+#else
+#  error ROOT_LENBITS must be in 8..12
+#endif
+#if ROOT_DISTBITS == 5
+#  define ENOUGH_DISTS 1072
+#elif ROOT_DISTBITS == 6
+#  define ENOUGH_DISTS 592
+#elif ROOT_DISTBITS == 7
+#  define ENOUGH_DISTS 400
+#elif ROOT_DISTBITS == 8
+#  define ENOUGH_DISTS 400
+#elif ROOT_DISTBITS == 9
+#  define ENOUGH_DISTS 592
+#elif ROOT_DISTBITS == 10
+#  define ENOUGH_DISTS 1072
+#else
+#  error ROOT_DISTBITS must be in 5..10
+#endif
 #define ENOUGH (ENOUGH_LENS+ENOUGH_DISTS)
 
 /* Type of code to build for inflate_table() */
@@ -60,3 +99,4 @@ typedef enum {
 int ZLIB_INTERNAL inflate_table OF((codetype type, unsigned short FAR *lens,
                              unsigned codes, code FAR * FAR *table,
                              unsigned FAR *bits, unsigned short FAR *work));
+void ZLIB_INTERNAL inflate_pairs OF((code FAR *table, unsigned bits));
@@ -34,6 +34,7 @@ z_const char hello[] = "hello, hello!";
 const char dictionary[] = "hello";
 uLong dictId; /* Adler32 value of the dictionary */
 
+void hello_text         OF((Byte *buf, uLong len));
 void test_deflate       OF((Byte *compr, uLong comprLen));
 void test_inflate       OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
@@ -41,12 +42,39 @@ void test_large_deflate OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
 void test_large_inflate OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
+void test_repeat        OF((Byte *compr, uLong comprLen));
 void test_flush         OF((Byte *compr, uLong *comprLen));
 void test_sync          OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
+void test_sync_find     OF((Byte *compr, uLong comprLen));
 void test_dict_deflate  OF((Byte *compr, uLong comprLen));
 void test_dict_inflate  OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
+void test_dict_prepared OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_dict_train    OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_rsyncable     OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+int  save_point         OF((void FAR *desc, z_pointp here));
+void test_access_points OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_vec           OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_batch         OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_inflate_batch OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_inflate_cache OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_combine       OF((Byte *uncompr, uLong uncomprLen));
+void test_validate      OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_checkpoint    OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
+void test_ring          OF((Byte *compr, uLong comprLen));
+void test_copy          OF((Byte *compr, uLong comprLen,
+                            Byte *uncompr, uLong uncomprLen));
 int  main               OF((int argc, char *argv[]));
 
 
@@ -81,6 +109,8 @@ void test_compress      OF((Byte *compr, uLong comprLen,
                             Byte *uncompr, uLong uncomprLen));
 void test_gzio          OF((const char *fname,
                             Byte *uncompr, uLong uncomprLen));
+void test_gzio_blocked  OF((const char *fname,
+                            Byte *uncompr, uLong uncomprLen));
 
 /* ===========================================================================
  * Test compress() and uncompress()
@@ -192,8 +222,88 @@ void test_gzio(fname, uncompr, uncomprLen)
 #endif
 }
 
+/* ===========================================================================
+ * Test seeking in blocked .gz files, with and without an index
+ */
+void test_gzio_blocked(fname, uncompr, uncomprLen)
+    const char *fname; /* compressed file name */
+    Byte *uncompr;
+    uLong uncomprLen;
+{
+#ifdef NO_GZCOMPRESS
+    fprintf(stderr, "NO_GZCOMPRESS -- gz* functions cannot compress\n");
+#else
+    static const char *mode[2] = {"wb6B", "wb6I"};
+    static const z_off_t seek[4] = {150000L, 1000L, 65280L, 199990L};
+    Byte *data;
+    uLong len = 200000L, i;
+    int err, m, k;
+    unsigned want;
+    gzFile file;
+
+    data = (Byte*)malloc((size_t)len);
+    if (data == Z_NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < len; i++)
+        data[i] = (Byte)(i % 251 < 13 ? i * 7 : i / 1000);
+
+    for (m = 0; m < 2; m++) {
+        file = gzopen(fname, mode[m]);
+        if (file == NULL) {
+            fprintf(stderr, "gzopen error\n");
+            exit(1);
+        }
+        for (i = 0; i < len; i += 30000L)
+            if (gzwrite(file, data + i,
+                        (unsigned)(len - i < 30000L ? len - i : 30000L)) <= 0) {
+                fprintf(stderr, "gzwrite err: %s\n", gzerror(file, &err));
+                exit(1);
+            }
+        gzclose(file);
+
+        file = gzopen(fname, "rb");
+        if (file == NULL) {
+            fprintf(stderr, "gzopen error\n");
+            exit(1);
+        }
+        for (k = 0; k < 4; k++) {
+            want = (unsigned)(len - seek[k] < uncomprLen ?
+                              len - seek[k] : uncomprLen);
+            if (gzseek(file, seek[k], SEEK_SET) != seek[k] ||
+                gzread(file, uncompr, want) != (int)want ||
+                memcmp(uncompr, data + seek[k], want)) {
+                fprintf(stderr, "bad blocked gzseek to %ld\n",
+                        (long)seek[k]);
+                exit(1);
+            }
+        }
+        gzclose(file);
+    }
+    free(data);
+    printf("blocked gzseek(): OK\n");
+#endif
+}
+
 #endif /* Z_SOLO */
 
+/* ===========================================================================
+ * Fill buf with len pseudo-random characters of the hello string: text that
+ * compresses, but not too well
+ */
+void hello_text(buf, len)
+    Byte *buf;
+    uLong len;
+{
+    uLong i, seed = 1;
+
+    for (i = 0; i < len; i++) {
+        seed = seed * 1103515245L + 12345;
+        buf[i] = hello[(seed >> 16) % 13];
+    }
+}
+
 /* ===========================================================================
  * Test deflate() with small buffers
  */
@@ -369,6 +479,73 @@ void test_large_inflate(compr, comprLen, uncompr, uncomprLen)
     }
 }
 
+/* ===========================================================================
+ * Test that deflate() finds repeats of incompressible data that are more
+ * than 4K back
+ */
+void test_repeat(compr, comprLen)
+    Byte *compr;
+    uLong comprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    uLong i, seed = 1, len = 100000L, period = 20000L;
+    Byte *data, *back;
+    int err;
+
+    data = (Byte*)calloc((uInt)len, 1);
+    back = (Byte*)calloc((uInt)len, 1);
+    if (data == Z_NULL || back == Z_NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < len; i++) {
+        seed = seed * 1103515245L + 12345;
+        data[i] = i < period ? (Byte)(seed >> 16) : data[i - period];
+    }
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    c_stream.next_in  = data;
+    c_stream.avail_in = (uInt)len;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END || c_stream.total_out >= period + period / 8) {
+        fprintf(stderr, "deflate missed repeats: %ld\n", c_stream.total_out);
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)c_stream.total_out;
+    d_stream.next_out = back;
+    d_stream.avail_out = (uInt)len;
+    err = inflate(&d_stream, Z_FINISH);
+    if (err != Z_STREAM_END || d_stream.total_out != len ||
+        memcmp(back, data, (size_t)len)) {
+        fprintf(stderr, "bad inflate of repeats\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    printf("repeats: %lu bytes to %lu\n", len, c_stream.total_out);
+    free(data);
+    free(back);
+}
+
 /* ===========================================================================
  * Test deflate() with full flush
  */
@@ -451,6 +628,37 @@ void test_sync(compr, comprLen, uncompr, uncomprLen)
     printf("after inflateSync(): hel%s\n", (char *)uncompr);
 }
 
+/* ===========================================================================
+ * Test inflateSyncFind() a byte at a time and all at once
+ */
+void test_sync_find(compr, comprLen)
+    Byte *compr;
+    uLong comprLen;
+{
+    uLong pos, found;
+    unsigned have;
+
+    for (pos = 3; pos < comprLen; pos++)
+        if (compr[pos - 3] == 0 && compr[pos - 2] == 0 &&
+            compr[pos - 1] == 0xff && compr[pos] == 0xff)
+            break;
+    if (pos == comprLen) {
+        fprintf(stderr, "no full flush point\n");
+        exit(1);
+    }
+
+    have = 0;
+    for (found = 0; found < comprLen && have != 4; found++)
+        inflateSyncFind(compr + found, 1, &have);
+    if (found != pos + 1 ||
+        (have = 0, inflateSyncFind(compr, (uInt)comprLen, &have)) !=
+            pos + 1 || have != 4) {
+        fprintf(stderr, "bad inflateSyncFind\n");
+        exit(1);
+    }
+    printf("inflateSyncFind(): %lu\n", found);
+}
+
 /* ===========================================================================
  * Test deflate() with preset dictionary
  */
@@ -538,6 +746,1090 @@ void test_dict_inflate(compr, comprLen, uncompr, uncomprLen)
     }
 }
 
+/* ===========================================================================
+ * Test deflate() and inflate() with a prepared dictionary shared by two
+ * streams. compr holds the output of test_dict_deflate().
+ */
+void test_dict_prepared(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    int err, i;
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    z_dictp dict;
+    Byte out[64];
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_BEST_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+
+    err = deflatePrepareDictionary(&c_stream,
+                (const Bytef*)dictionary, (int)sizeof(dictionary), &dict);
+    CHECK_ERR(err, "deflatePrepareDictionary");
+
+    for (i = 0; i < 2; i++) {
+        err = deflateUseDictionary(&c_stream, dict);
+        CHECK_ERR(err, "deflateUseDictionary");
+
+        c_stream.next_out = uncompr;
+        c_stream.avail_out = (uInt)uncomprLen;
+        c_stream.next_in = (z_const unsigned char *)hello;
+        c_stream.avail_in = (uInt)strlen(hello)+1;
+
+        err = deflate(&c_stream, Z_FINISH);
+        if (err != Z_STREAM_END) {
+            fprintf(stderr, "deflate should report Z_STREAM_END\n");
+            exit(1);
+        }
+        if (c_stream.total_out > comprLen ||
+            memcmp(uncompr, compr, (size_t)c_stream.total_out)) {
+            fprintf(stderr, "bad deflate with prepared dict\n");
+            exit(1);
+        }
+        err = deflateReset(&c_stream);
+        CHECK_ERR(err, "deflateReset");
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+    err = deflateFreeDictionary(&c_stream, dict);
+    CHECK_ERR(err, "deflateFreeDictionary");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)comprLen;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+
+    d_stream.next_out = out;
+    d_stream.avail_out = (uInt)sizeof(out);
+
+    for (;;) {
+        err = inflate(&d_stream, Z_NO_FLUSH);
+        if (err == Z_STREAM_END) break;
+        if (err == Z_NEED_DICT)
+            err = inflateUseDictionary(&d_stream, (const Bytef*)dictionary,
+                                       (int)sizeof(dictionary));
+        CHECK_ERR(err, "inflate with shared dict");
+    }
+
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    if (strcmp((char*)out, hello)) {
+        fprintf(stderr, "bad inflate with shared dict\n");
+        exit(1);
+    } else {
+        printf("inflate with prepared dictionary: %s\n", (char *)out);
+    }
+}
+
+/* ===========================================================================
+ * Test deflateTrainDictionary() with samples that share the hello string, and
+ * check that the dictionary helps to compress another such message
+ */
+void test_dict_train(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    uInt lengths[8];
+    uInt dictLength = (uInt)comprLen / 2;
+    uInt msgLength, size[2];
+    uLong len = 0;
+    Byte *dict = compr, *msg, *back;
+    unsigned i;
+    int err;
+
+    for (i = 0; i < 8; i++) {
+        sprintf((char *)uncompr + len, "%u: %s %u", i, hello, 7 * i);
+        lengths[i] = (uInt)strlen((char *)uncompr + len);
+        len += lengths[i];
+    }
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateTrainDictionary(&c_stream, dict, &dictLength, uncompr,
+                                 lengths, 8);
+    CHECK_ERR(err, "deflateTrainDictionary");
+    if (dictLength == 0 || dictLength > len || 2 * len > uncomprLen) {
+        fprintf(stderr, "bad deflateTrainDictionary\n");
+        exit(1);
+    }
+
+    /* compress a new message without and then with the dictionary */
+    msg = uncompr + len;
+    sprintf((char *)msg, "%u: %s %u", 8, hello, 56);
+    msgLength = (uInt)strlen((char *)msg) + 1;
+    back = msg + msgLength;
+    for (i = 0; i < 2; i++) {
+        err = deflateInit(&c_stream, Z_BEST_COMPRESSION);
+        CHECK_ERR(err, "deflateInit");
+        if (i) {
+            err = deflateSetDictionary(&c_stream, dict, dictLength);
+            CHECK_ERR(err, "deflateSetDictionary");
+        }
+        c_stream.next_in = msg;
+        c_stream.avail_in = msgLength;
+        c_stream.next_out = compr + comprLen / 2;
+        c_stream.avail_out = (uInt)(comprLen / 2);
+        err = deflate(&c_stream, Z_FINISH);
+        if (err != Z_STREAM_END) {
+            fprintf(stderr, "deflate should report Z_STREAM_END\n");
+            exit(1);
+        }
+        size[i] = (uInt)c_stream.total_out;
+        err = deflateEnd(&c_stream);
+        CHECK_ERR(err, "deflateEnd");
+    }
+    if (size[1] >= size[0]) {
+        fprintf(stderr, "trained dictionary does not help: %u >= %u\n",
+                size[1], size[0]);
+        exit(1);
+    }
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+    d_stream.next_in = compr + comprLen / 2;
+    d_stream.avail_in = size[1];
+    d_stream.next_out = back;
+    d_stream.avail_out = msgLength;
+    err = inflate(&d_stream, Z_NO_FLUSH);
+    if (err == Z_NEED_DICT) {
+        err = inflateSetDictionary(&d_stream, dict, dictLength);
+        CHECK_ERR(err, "inflateSetDictionary");
+        err = inflate(&d_stream, Z_NO_FLUSH);
+    }
+    if (err != Z_STREAM_END || d_stream.total_out != msgLength ||
+        memcmp(back, msg, msgLength)) {
+        fprintf(stderr, "bad inflate with trained dictionary\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    printf("deflateTrainDictionary(): %u bytes, %u -> %u\n", dictLength,
+           size[0], size[1]);
+}
+
+/* ===========================================================================
+ * Test deflate() in rsyncable mode
+ */
+void test_rsyncable(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    uLong len = uncomprLen / 2;
+    Byte *back;
+    int err;
+
+    /* text that is not too repetitive, so there are rsyncable points */
+    hello_text(uncompr, len);
+    back = uncompr + len;
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    err = deflateRsyncable(&c_stream, 8);
+    CHECK_ERR(err, "deflateRsyncable");
+
+    c_stream.next_in = uncompr;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    while (c_stream.total_in != len) {
+        c_stream.avail_in += 1000;      /* feed the input in pieces */
+        if (c_stream.avail_in > len - c_stream.total_in)
+            c_stream.avail_in = (uInt)(len - c_stream.total_in);
+        err = deflate(&c_stream, Z_NO_FLUSH);
+        CHECK_ERR(err, "deflate");
+    }
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)c_stream.total_out;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+
+    d_stream.next_out = back;
+    d_stream.avail_out = (uInt)(uncomprLen - len);
+
+    err = inflate(&d_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    if (d_stream.total_out != len || memcmp(back, uncompr, (size_t)len)) {
+        fprintf(stderr, "bad rsyncable deflate\n");
+        exit(1);
+    } else {
+        printf("rsyncable deflate(): %lu -> %lu\n", len, c_stream.total_out);
+    }
+}
+
+/* ===========================================================================
+ * Keep the second access point reported by deflate()
+ */
+static int points;
+static z_point point;
+static Byte point_window[32768];
+
+int save_point(desc, here)
+    void FAR *desc;
+    z_pointp here;
+{
+    (void)desc;
+    if (++points == 2) {
+        point = *here;
+        if (here->window_len)
+            memcpy(point_window, here->window, here->window_len);
+        point.window = point_window;
+    }
+    return 0;
+}
+
+/* ===========================================================================
+ * Test inflate() from the access points reported by deflate()
+ */
+void test_access_points(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    uLong len = uncomprLen / 2;
+    Byte *back = uncompr + len;
+    int err, full;
+
+    hello_text(uncompr, len);
+
+    for (full = 0; full < 2; full++) {
+        c_stream.zalloc = zalloc;
+        c_stream.zfree = zfree;
+        c_stream.opaque = (voidpf)0;
+
+        /* small memLevel for many blocks, so many points without a flush */
+        err = deflateInit2(&c_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                           MAX_WBITS, 1, Z_DEFAULT_STRATEGY);
+        CHECK_ERR(err, "deflateInit2");
+        points = 0;
+        err = deflateAccessPoints(&c_stream, 4096, full, save_point, Z_NULL);
+        CHECK_ERR(err, "deflateAccessPoints");
+
+        c_stream.next_in = uncompr;
+        c_stream.avail_in = (uInt)len;
+        c_stream.next_out = compr;
+        c_stream.avail_out = (uInt)comprLen;
+        err = deflate(&c_stream, Z_FINISH);
+        if (err != Z_STREAM_END) {
+            fprintf(stderr, "deflate should report Z_STREAM_END\n");
+            exit(1);
+        }
+        err = deflateEnd(&c_stream);
+        CHECK_ERR(err, "deflateEnd");
+        if (points < 2 || (full && (point.in != 8192 || point.window_len))) {
+            fprintf(stderr, "bad access points\n");
+            exit(1);
+        }
+
+        /* decompress from the second point */
+        d_stream.zalloc = zalloc;
+        d_stream.zfree = zfree;
+        d_stream.opaque = (voidpf)0;
+
+        err = inflateInit2(&d_stream, -MAX_WBITS);
+        CHECK_ERR(err, "inflateInit2");
+        if (point.bits) {
+            err = inflatePrime(&d_stream, point.bits,
+                               compr[point.out - 1] >> (8 - point.bits));
+            CHECK_ERR(err, "inflatePrime");
+        }
+        if (point.window_len) {
+            err = inflateSetDictionary(&d_stream, point.window,
+                                       point.window_len);
+            CHECK_ERR(err, "inflateSetDictionary");
+        }
+        d_stream.next_in  = compr + point.out;
+        d_stream.avail_in = (uInt)(c_stream.total_out - point.out);
+        d_stream.next_out = back;
+        d_stream.avail_out = (uInt)(len - point.in);
+        err = inflate(&d_stream, Z_NO_FLUSH);
+        if (err != Z_OK && err != Z_STREAM_END) {
+            CHECK_ERR(err, "inflate from access point");
+        }
+        err = inflateEnd(&d_stream);
+        CHECK_ERR(err, "inflateEnd");
+
+        if (d_stream.avail_out ||
+            memcmp(back, uncompr + point.in, (size_t)(len - point.in))) {
+            fprintf(stderr, "bad inflate from access point\n");
+            exit(1);
+        } else {
+            printf("inflate from %s access point at %lu: OK\n",
+                   full ? "flushed" : "window", point.in);
+        }
+    }
+}
+
+/* ===========================================================================
+ * Test deflateV() and inflateV() with scattered input and output
+ */
+void test_vec(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    z_vec in[40], out[40];
+    uLong pos;
+    uLong len = uncomprLen / 2;
+    unsigned n;
+    Byte *back;
+    int err;
+
+    hello_text(uncompr, len);
+    back = uncompr + len;
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+
+    /* input in pieces of varying size, some empty, output in small pieces */
+    for (n = 0, pos = 0; n < 40; n++) {
+        in[n].base = uncompr + pos;
+        in[n].len = n % 5 == 3 ? 0 : (uInt)((len - pos) / 4);
+        if (n == 39)
+            in[n].len = (uInt)(len - pos);
+        pos += in[n].len;
+        out[n].base = compr + n * (comprLen / 40);
+        out[n].len = (uInt)(comprLen / 40);
+    }
+    err = deflateV(&c_stream, in, 40, out, 1, Z_FINISH);
+    CHECK_ERR(err, "deflateV");
+    if (out[0].len != 0) {
+        fprintf(stderr, "deflateV should fill the output segment\n");
+        exit(1);
+    }
+    err = deflateV(&c_stream, in, 40, out + 1, 39, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflateV should report Z_STREAM_END\n");
+        exit(1);
+    }
+    for (n = 0; n < 40; n++)
+        if (in[n].len != 0) {
+            fprintf(stderr, "deflateV should consume all of the input\n");
+            exit(1);
+        }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+    d_stream.next_in = Z_NULL;
+    d_stream.avail_in = 0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+
+    /* the compressed data is contiguous, since the output segments were */
+    for (n = 0, pos = 0; n < 40; n++) {
+        in[n].base = compr + pos;
+        in[n].len = (uInt)((c_stream.total_out - pos) / (40 - n));
+        pos += in[n].len;
+    }
+    for (n = 0, pos = 0; n < 40; n++) {
+        out[n].base = back + pos;
+        out[n].len = n % 7 == 1 ? 0 : (uInt)((uncomprLen - len - pos) / 4);
+        if (n == 39)
+            out[n].len = (uInt)(uncomprLen - len - pos);
+        pos += out[n].len;
+    }
+    err = inflateV(&d_stream, in, 40, out, 40, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflateV should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    if (d_stream.total_out != len || memcmp(back, uncompr, (size_t)len)) {
+        fprintf(stderr, "bad deflateV/inflateV\n");
+        exit(1);
+    } else {
+        printf("deflateV()/inflateV(): %lu -> %lu\n", len, c_stream.total_out);
+    }
+}
+
+/* ===========================================================================
+ * Test deflateBatch() on short records, with and without a dictionary
+ */
+void test_batch(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    z_dictp dict;
+    Bytef *dest[8];
+    const Bytef *source[8];
+    uLongf destLen[8];
+    uLong sourceLen[8], total = 0;
+    int err, n, pass;
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_BEST_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    err = deflatePrepareDictionary(&c_stream, (const Bytef*)dictionary,
+                                   (int)sizeof(dictionary), &dict);
+    CHECK_ERR(err, "deflatePrepareDictionary");
+
+    /* records of hello with a varying tail, the last one not fitting */
+    for (n = 0; n < 8; n++) {
+        sprintf((char *)uncompr + n * 64, "%s %d", hello, n * n * n);
+        source[n] = uncompr + n * 64;
+        sourceLen[n] = (uLong)strlen((char *)source[n]);
+        dest[n] = compr + n * (comprLen / 8);
+    }
+    for (pass = 0; pass < 2; pass++) {
+        for (n = 0; n < 8; n++)
+            destLen[n] = n == 7 ? 4 : comprLen / 8;
+        err = deflateBatch(&c_stream, pass ? dict : Z_NULL,
+                           dest, destLen, source, sourceLen, 8);
+        if (err != Z_BUF_ERROR || destLen[7] != 0) {
+            fprintf(stderr, "deflateBatch should report Z_BUF_ERROR\n");
+            exit(1);
+        }
+
+        for (n = 0; n < 7; n++) {
+            d_stream.zalloc = zalloc;
+            d_stream.zfree = zfree;
+            d_stream.opaque = (voidpf)0;
+            d_stream.next_in = dest[n];
+            d_stream.avail_in = (uInt)destLen[n];
+
+            err = inflateInit(&d_stream);
+            CHECK_ERR(err, "inflateInit");
+            d_stream.next_out = uncompr + uncomprLen / 2;
+            d_stream.avail_out = (uInt)(uncomprLen / 2);
+            err = inflate(&d_stream, Z_FINISH);
+            if (err == Z_NEED_DICT && pass) {
+                err = inflateSetDictionary(&d_stream, (const Bytef*)dictionary,
+                                           (int)sizeof(dictionary));
+                CHECK_ERR(err, "inflateSetDictionary");
+                err = inflate(&d_stream, Z_FINISH);
+            }
+            if (err != Z_STREAM_END) {
+                fprintf(stderr, "inflate should report Z_STREAM_END\n");
+                exit(1);
+            }
+            err = inflateEnd(&d_stream);
+            CHECK_ERR(err, "inflateEnd");
+            if (d_stream.total_out != sourceLen[n] ||
+                memcmp(uncompr + uncomprLen / 2, source[n],
+                       (size_t)sourceLen[n])) {
+                fprintf(stderr, "bad deflateBatch record %d\n", n);
+                exit(1);
+            }
+            total += destLen[n];
+        }
+    }
+    err = deflateFreeDictionary(&c_stream, dict);
+    CHECK_ERR(err, "deflateFreeDictionary");
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    printf("deflateBatch(): %lu bytes for 14 records\n", total);
+}
+
+/* ===========================================================================
+ * Test inflateBatch() on records that need a dictionary, with one record
+ * damaged and one that does not fit
+ */
+void test_inflate_batch(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    z_dictp dict;
+    Bytef *dest[8], *back[8];
+    const Bytef *source[8];
+    uLongf destLen[8], backLen[8];
+    uLong sourceLen[8];
+    int status[8];
+    int err, n;
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    err = deflatePrepareDictionary(&c_stream, (const Bytef*)dictionary,
+                                   (int)sizeof(dictionary), &dict);
+    CHECK_ERR(err, "deflatePrepareDictionary");
+    for (n = 0; n < 8; n++) {
+        sprintf((char *)uncompr + n * 64, "%s %d", hello, n * 1001);
+        source[n] = uncompr + n * 64;
+        sourceLen[n] = (uLong)strlen((char *)source[n]);
+        dest[n] = compr + n * (comprLen / 8);
+        destLen[n] = comprLen / 8;
+        back[n] = uncompr + uncomprLen / 2 + n * 64;
+        backLen[n] = n == 6 ? 3 : 64;
+    }
+    err = deflateBatch(&c_stream, dict, dest, destLen, source, sourceLen, 8);
+    CHECK_ERR(err, "deflateBatch");
+    err = deflateFreeDictionary(&c_stream, dict);
+    CHECK_ERR(err, "deflateFreeDictionary");
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+    d_stream.next_in = Z_NULL;
+    d_stream.avail_in = 0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+
+    dest[3][destLen[3] - 1] ^= 1;       /* damage the check value */
+    err = inflateBatch(&d_stream, (const Bytef*)dictionary,
+                       (int)sizeof(dictionary), back, backLen,
+                       (const Bytef * const *)dest, destLen, status, 8);
+    if (err != Z_DATA_ERROR || status[3] != Z_DATA_ERROR ||
+        status[6] != Z_BUF_ERROR || backLen[3] != 0 || backLen[6] != 0) {
+        fprintf(stderr, "inflateBatch should report the bad records\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    for (n = 0; n < 8; n++)
+        if (n != 3 && n != 6 &&
+            (status[n] != Z_OK || backLen[n] != sourceLen[n] ||
+             memcmp(back[n], source[n], (size_t)sourceLen[n]))) {
+            fprintf(stderr, "bad inflateBatch record %d\n", n);
+            exit(1);
+        }
+    printf("inflateBatch(): 6 of 8 records\n");
+}
+
+/* ===========================================================================
+ * Test inflate() reusing the tables of repeated dynamic block headers, with
+ * more kinds of headers than it keeps, and inflateCopy() of a stream that is
+ * using them
+ */
+#define MSGS 48
+#define MSGLEN 256
+
+void test_inflate_cache(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+    z_stream e_stream; /* copy of the decompression stream */
+    uLong len = MSGS * MSGLEN, half = 20 * MSGLEN + MSGLEN / 2, seed;
+    Byte *out = uncompr + len, *copied = uncompr + 2 * len;
+    int err, n, k, kind;
+
+    if (uncomprLen < 3 * len) {
+        fprintf(stderr, "buffer too small for the inflate cache test\n");
+        exit(1);
+    }
+
+    /* six kinds of messages, each with its own letter frequencies, in an
+       order that makes inflate() cache, reuse, and replace their tables:
+       three of each kind, then the same backwards, then four kinds mixed */
+    for (n = 0; n < MSGS; n++) {
+        kind = n < 18 ? n / 3 : n < 36 ? 5 - (n - 18) / 3 : n & 3;
+        seed = kind + 1;
+        for (k = 0; k < MSGLEN; k++) {
+            seed = seed * 1103515245L + 12345;
+            uncompr[n * MSGLEN + k] =
+                "etaoinshrdlucmfwypvbgkjqxz"[(seed >> 16) % (3 + 4 * kind)];
+        }
+    }
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    for (n = 0; n < MSGS; n++) {
+        /* a full flush makes the same message give the same block */
+        c_stream.next_in = uncompr + n * MSGLEN;
+        c_stream.avail_in = MSGLEN;
+        err = deflate(&c_stream, Z_FULL_FLUSH);
+        CHECK_ERR(err, "deflate");
+    }
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)c_stream.total_out;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+
+    /* copy the stream midway through the third of a kind of message, when
+       the tables are from the cache */
+    d_stream.next_out = out;
+    d_stream.avail_out = (uInt)half;
+    err = inflate(&d_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "inflate");
+    err = inflateCopy(&e_stream, &d_stream);
+    CHECK_ERR(err, "inflateCopy");
+
+    d_stream.avail_out = (uInt)(len - d_stream.total_out);
+    err = inflate(&d_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    e_stream.next_out = copied;
+    e_stream.avail_out = (uInt)(len - e_stream.total_out);
+    err = inflate(&e_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflate of copy should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&e_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    if (memcmp(out, uncompr, (size_t)len) ||
+        memcmp(copied, uncompr + half, (size_t)(len - half))) {
+        fprintf(stderr, "bad inflate with repeated headers\n");
+        exit(1);
+    }
+    printf("inflate(): %d blocks with six kinds of header\n", MSGS);
+}
+
+/* ===========================================================================
+ * Test crc32_combine() and adler32_combine(), and the operator versions, on
+ * the check values of pieces of the same length
+ */
+void test_combine(uncompr, uncomprLen)
+    Byte *uncompr;
+    uLong uncomprLen;
+{
+    uLong crc, adler, crc_piece, adler_piece, crc_op, adler_op, i;
+    uLong crc_gen, adler_gen, piece = uncomprLen / 10;
+
+    for (i = 0; i < uncomprLen; i++)
+        uncompr[i] = (Byte)(i * i + (i >> 7));
+    crc = crc32(crc32(0L, Z_NULL, 0), uncompr, (uInt)uncomprLen);
+    adler = adler32(adler32(0L, Z_NULL, 0), uncompr, (uInt)uncomprLen);
+
+    crc_gen = crc32_combine_gen((z_off_t)piece);
+    adler_gen = adler32_combine_gen((z_off_t)piece);
+    crc_op = crc_piece = crc32(0L, Z_NULL, 0);
+    adler_op = adler_piece = adler32(0L, Z_NULL, 0);
+    for (i = 0; i < 10; i++) {
+        uLong crc_next = crc32(crc32(0L, Z_NULL, 0), uncompr + i * piece,
+                               (uInt)piece);
+        uLong adler_next = adler32(adler32(0L, Z_NULL, 0),
+                                   uncompr + i * piece, (uInt)piece);
+
+        crc_piece = crc32_combine(crc_piece, crc_next, (z_off_t)piece);
+        adler_piece = adler32_combine(adler_piece, adler_next,
+                                      (z_off_t)piece);
+        crc_op = crc32_combine_op(crc_op, crc_next, crc_gen);
+        adler_op = adler32_combine_op(adler_op, adler_next, adler_gen);
+    }
+    if (crc_piece != crc || crc_op != crc || adler_piece != adler ||
+        adler_op != adler) {
+        fprintf(stderr, "bad combine\n");
+        exit(1);
+    } else {
+        printf("crc32_combine(), adler32_combine(): %08lx %08lx\n", crc,
+               adler);
+    }
+}
+
+/* ===========================================================================
+ * Test inflateValidate() on a zlib stream with a damaged check value
+ */
+void test_validate(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    int err, check;
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    c_stream.next_in  = (z_const unsigned char *)hello;
+    c_stream.avail_in = (uInt)strlen(hello)+1;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+    comprLen = c_stream.total_out;
+    compr[comprLen - 1] ^= 1;
+
+    for (check = 1; check >= 0; check--) {
+        strcpy((char*)uncompr, "garbage");
+
+        d_stream.zalloc = zalloc;
+        d_stream.zfree = zfree;
+        d_stream.opaque = (voidpf)0;
+
+        err = inflateInit(&d_stream);
+        CHECK_ERR(err, "inflateInit");
+        err = inflateValidate(&d_stream, check);
+        CHECK_ERR(err, "inflateValidate");
+
+        d_stream.next_in  = compr;
+        d_stream.avail_in = (uInt)comprLen;
+        d_stream.next_out = uncompr;
+        d_stream.avail_out = (uInt)uncomprLen;
+        err = inflate(&d_stream, Z_FINISH);
+        if (err != (check ? Z_DATA_ERROR : Z_STREAM_END) ||
+            strcmp((char*)uncompr, hello)) {
+            fprintf(stderr, "bad inflateValidate(%d)\n", check);
+            exit(1);
+        }
+
+        err = inflateEnd(&d_stream);
+        CHECK_ERR(err, "inflateEnd");
+    }
+    printf("inflateValidate(): %s\n", (char *)uncompr);
+}
+
+/* ===========================================================================
+ * Test deflateSave() and inflateSave() with streams ended and restored midway
+ */
+void test_checkpoint(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    int err;
+    uLong len, size;
+    Byte *ckpt;
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+
+    /* compress hello, checkpoint, and compress it again in a new stream */
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    c_stream.next_in  = (z_const unsigned char *)hello;
+    c_stream.avail_in = (uInt)strlen(hello);
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_BLOCK);
+    CHECK_ERR(err, "deflate");
+    err = deflateSave(&c_stream, Z_NULL, &size);
+    CHECK_ERR(err, "deflateSave");
+    ckpt = (Byte*)calloc((uInt)size, 1);
+    if (ckpt == Z_NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    len = size;
+    err = deflateSave(&c_stream, ckpt, &len);
+    CHECK_ERR(err, "deflateSave");
+    err = deflateEnd(&c_stream);
+    if (err != Z_DATA_ERROR) {          /* freed before the end */
+        fprintf(stderr, "deflateEnd should report Z_DATA_ERROR\n");
+        exit(1);
+    }
+
+    err = deflateInit(&c_stream, Z_BEST_SPEED);
+    CHECK_ERR(err, "deflateInit");
+    err = deflateRestore(&c_stream, ckpt, len);
+    CHECK_ERR(err, "deflateRestore");
+    free(ckpt);
+    c_stream.next_in  = (z_const unsigned char *)hello;
+    c_stream.avail_in = (uInt)strlen(hello)+1;
+    c_stream.next_out = compr + c_stream.total_out;
+    c_stream.avail_out = (uInt)(comprLen - c_stream.total_out);
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+    comprLen = c_stream.total_out;
+
+    /* decompress half, checkpoint, and decompress the rest in a new stream */
+    strcpy((char*)uncompr, "garbage");
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)comprLen / 2;
+    d_stream.next_out = uncompr;
+    d_stream.avail_out = (uInt)uncomprLen;
+    err = inflate(&d_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "inflate");
+    err = inflateSave(&d_stream, Z_NULL, &size);
+    CHECK_ERR(err, "inflateSave");
+    ckpt = (Byte*)calloc((uInt)size, 1);
+    if (ckpt == Z_NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    len = size;
+    err = inflateSave(&d_stream, ckpt, &len);
+    CHECK_ERR(err, "inflateSave");
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+    err = inflateRestore(&d_stream, ckpt, len);
+    CHECK_ERR(err, "inflateRestore");
+    free(ckpt);
+    d_stream.next_in  = compr + d_stream.total_in;
+    d_stream.avail_in = (uInt)(comprLen - d_stream.total_in);
+    d_stream.next_out = uncompr + d_stream.total_out;
+    d_stream.avail_out = (uInt)(uncomprLen - d_stream.total_out);
+    err = inflate(&d_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "inflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    len = (uLong)strlen(hello);
+    if (d_stream.total_out != 2 * len + 1 ||
+        memcmp(uncompr, hello, (size_t)len) ||
+        strcmp((char*)uncompr + len, hello)) {
+        fprintf(stderr, "bad checkpoint\n");
+        exit(1);
+    }
+
+    /* a checkpoint taken while reading code length code lengths must be
+       rejected if it is changed to claim too many length codes, even with a
+       valid check value */
+    err = inflateInit2(&d_stream, -15);
+    CHECK_ERR(err, "inflateInit2");
+    compr[0] = 0x05;                    /* last dynamic block, HLIT 0 */
+    compr[1] = 0xe0;                    /* HDIST 0, HCLEN 19 */
+    compr[2] = 0x01;                    /* and the first code length code */
+    d_stream.next_in  = compr;
+    d_stream.avail_in = 3;
+    d_stream.next_out = uncompr;
+    d_stream.avail_out = (uInt)uncomprLen;
+    err = inflate(&d_stream, Z_NO_FLUSH);
+    CHECK_ERR(err, "inflate");
+    err = inflateSave(&d_stream, Z_NULL, &size);
+    CHECK_ERR(err, "inflateSave");
+    ckpt = compr + 3;
+    err = inflateSave(&d_stream, ckpt, &size);
+    CHECK_ERR(err, "inflateSave");
+    err = inflateRestore(&d_stream, ckpt, size);
+    CHECK_ERR(err, "inflateRestore");
+    ckpt[62] = 1;                       /* nlen, at 61, to 65536 + 257 */
+    len = adler32(1L, ckpt, (uInt)size - 4);
+    ckpt[size - 4] = (Byte)(len >> 24);
+    ckpt[size - 3] = (Byte)(len >> 16);
+    ckpt[size - 2] = (Byte)(len >> 8);
+    ckpt[size - 1] = (Byte)len;
+    err = inflateRestore(&d_stream, ckpt, size);
+    if (err != Z_DATA_ERROR) {
+        fprintf(stderr, "inflateRestore should report Z_DATA_ERROR\n");
+        exit(1);
+    }
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+
+    len = (uLong)strlen(hello);
+    printf("deflateSave(), inflateSave(): %s\n", (char *)uncompr + len);
+}
+
+/* ===========================================================================
+ * Test inflateRing() with the output written in place in a ring buffer
+ */
+void test_ring(compr, comprLen)
+    Byte *compr;
+    uLong comprLen;
+{
+    int err;
+    uLong i, len = 100000L, got;
+    unsigned size = 32768 + 5000;
+    Byte *data, *ring, *start;
+    z_stream c_stream; /* compression stream */
+    z_stream d_stream; /* decompression stream */
+
+    data = (Byte*)calloc((uInt)len, 1);
+    ring = (Byte*)calloc(size, 1);
+    if (data == Z_NULL || ring == Z_NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < len; i++)   /* matches that reach back 30000 bytes */
+        data[i] = (Byte)(i < 30000 ? i * 11 + (i >> 5) :
+                         (i % 1000 ? data[i - 30000] : i / 1000));
+
+    c_stream.zalloc = zalloc;
+    c_stream.zfree = zfree;
+    c_stream.opaque = (voidpf)0;
+
+    err = deflateInit(&c_stream, Z_DEFAULT_COMPRESSION);
+    CHECK_ERR(err, "deflateInit");
+    c_stream.next_in  = data;
+    c_stream.avail_in = (uInt)len;
+    c_stream.next_out = compr;
+    c_stream.avail_out = (uInt)comprLen;
+    err = deflate(&c_stream, Z_FINISH);
+    if (err != Z_STREAM_END) {
+        fprintf(stderr, "deflate should report Z_STREAM_END\n");
+        exit(1);
+    }
+    err = deflateEnd(&c_stream);
+    CHECK_ERR(err, "deflateEnd");
+
+    d_stream.zalloc = zalloc;
+    d_stream.zfree = zfree;
+    d_stream.opaque = (voidpf)0;
+
+    err = inflateInit(&d_stream);
+    CHECK_ERR(err, "inflateInit");
+    err = inflateRing(&d_stream, ring, size);
+    CHECK_ERR(err, "inflateRing");
+
+    d_stream.next_in  = compr;
+    d_stream.avail_in = (uInt)c_stream.total_out;
+    d_stream.next_out = ring;
+    got = 0;
+    do {
+        if (d_stream.next_out == ring + size)
+            d_stream.next_out = ring;
+        start = d_stream.next_out;
+        d_stream.avail_out = (uInt)(ring + size - start);
+        err = inflate(&d_stream, Z_NO_FLUSH);
+        if (err != Z_STREAM_END)
+            CHECK_ERR(err, "inflate");
+        i = (uLong)(d_stream.next_out - start);
+        if (i > size - 32768 || i > len - got ||
+            memcmp(start, data + got, (size_t)i)) {
+            fprintf(stderr, "bad inflateRing\n");
+            exit(1);
+        }
+        got += i;
+    } while (err != Z_STREAM_END);
+
+    err = inflateEnd(&d_stream);
+    CHECK_ERR(err, "inflateEnd");
+    if (got != len) {
+        fprintf(stderr, "bad inflateRing length\n");
+        exit(1);
+    }
+    free(data);
+    free(ring);
+    printf("inflateRing(): %lu bytes\n", got);
+}
+
+/* ===========================================================================
+ * Test crc32_copy() and adler32_copy() against separate copies and checks
+ */
+void test_copy(compr, comprLen, uncompr, uncomprLen)
+    Byte *compr, *uncompr;
+    uLong comprLen, uncomprLen;
+{
+    uLong crc, adler, len = uncomprLen - 1;
+
+    if (len > comprLen - 1)
+        len = comprLen - 1;
+    crc = crc32(crc32(0L, Z_NULL, 0), uncompr + 1, (uInt)len);
+    adler = adler32(adler32(0L, Z_NULL, 0), uncompr + 1, (uInt)len);
+
+    memset(compr, 0, (size_t)comprLen);
+    if (crc32_copy(crc32(0L, Z_NULL, 0), compr, uncompr + 1, (uInt)len) !=
+            crc || memcmp(compr, uncompr + 1, (size_t)len)) {
+        fprintf(stderr, "bad crc32_copy\n");
+        exit(1);
+    }
+    memset(compr, 0, (size_t)comprLen);
+    if (adler32_copy(adler32(0L, Z_NULL, 0), compr + 1, uncompr + 1,
+                     (uInt)len - 1) !=
+            adler32(adler32(0L, Z_NULL, 0), uncompr + 1, (uInt)len - 1) ||
+        memcmp(compr + 1, uncompr + 1, (size_t)len - 1) ||
+        adler32_copy(adler32(0L, Z_NULL, 0), compr, uncompr + 1,
+                     (uInt)len) != adler) {
+        fprintf(stderr, "bad adler32_copy\n");
+        exit(1);
+    }
+    printf("crc32_copy(), adler32_copy(): %08lx %08lx\n", crc, adler);
+}
+
 /* ===========================================================================
  * Usage:  example [output.gz  [input.gz]]
  */
@@ -579,6 +1871,8 @@ int main(argc, argv)
 
     test_gzio((argc > 1 ? argv[1] : TESTFILE),
               uncompr, uncomprLen);
+    test_gzio_blocked((argc > 1 ? argv[1] : TESTFILE),
+                      uncompr, uncomprLen);
 #endif
 
     test_deflate(compr, comprLen);
@@ -586,13 +1880,28 @@ int main(argc, argv)
 
     test_large_deflate(compr, comprLen, uncompr, uncomprLen);
     test_large_inflate(compr, comprLen, uncompr, uncomprLen);
+    test_repeat(compr, comprLen);
 
     test_flush(compr, &comprLen);
     test_sync(compr, comprLen, uncompr, uncomprLen);
+    test_sync_find(compr, comprLen);
     comprLen = uncomprLen;
 
     test_dict_deflate(compr, comprLen);
     test_dict_inflate(compr, comprLen, uncompr, uncomprLen);
+    test_dict_prepared(compr, comprLen, uncompr, uncomprLen);
+    test_dict_train(compr, comprLen, uncompr, uncomprLen);
+    test_rsyncable(compr, comprLen, uncompr, uncomprLen);
+    test_access_points(compr, comprLen, uncompr, uncomprLen);
+    test_vec(compr, comprLen, uncompr, uncomprLen);
+    test_batch(compr, comprLen, uncompr, uncomprLen);
+    test_inflate_batch(compr, comprLen, uncompr, uncomprLen);
+    test_inflate_cache(compr, comprLen, uncompr, uncomprLen);
+    test_combine(uncompr, uncomprLen);
+    test_validate(compr, comprLen, uncompr, uncomprLen);
+    test_checkpoint(compr, comprLen, uncompr, uncomprLen);
+    test_ring(compr, comprLen);
+    test_copy(compr, comprLen, uncompr, uncomprLen);
 
     free(compr);
     free(uncompr);
@@ -0,0 +1,208 @@
+/* minidict.c -- build a preset dictionary from sample files
+ * Copyright (C) 2026 The Android Open Source Project
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/*
+ * minidict reads the sample files named on the command line, builds a
+ * preset dictionary from them with deflateTrainDictionary(), and writes the
+ * dictionary to standard output.  Then it compresses each sample with and
+ * without the dictionary, and reports the sizes and the gain to standard
+ * error.  The gain is measured on the training samples, so it is an upper
+ * bound for new data of the same kind.
+ */
+
+/* @(#) $Id$ */
+
+#include "zlib.h"
+#include <stdio.h>
+
+#ifdef STDC
+#  include <string.h>
+#  include <stdlib.h>
+#endif
+
+#if defined(MSDOS) || defined(OS2) || defined(WIN32) || defined(__CYGWIN__)
+#  include <fcntl.h>
+#  include <io.h>
+#  define SET_BINARY_MODE(file) setmode(fileno(file), O_BINARY)
+#else
+#  define SET_BINARY_MODE(file)
+#endif
+
+#define MAX_DICT 32768
+
+static char *prog;
+
+void  error           OF((const char *msg));
+uLong load            OF((const char *name, Bytef **buf, uLong *size,
+                          uLong len));
+uLong compressed_size OF((const Bytef *data, uInt len, int level,
+                          const Bytef *dict, uInt dictLen));
+int   main            OF((int argc, char *argv[]));
+
+/* ===========================================================================
+ * Display error message and exit
+ */
+void error(msg)
+    const char *msg;
+{
+    fprintf(stderr, "%s: %s\n", prog, msg);
+    exit(1);
+}
+
+/* ===========================================================================
+ * Append the contents of the file name to *buf, which holds len bytes and has
+ * room for *size bytes, and return the length of the file.
+ */
+uLong load(name, buf, size, len)
+    const char *name;
+    Bytef **buf;
+    uLong *size;
+    uLong len;
+{
+    FILE *in;
+    size_t got;
+    uLong start = len;
+
+    in = fopen(name, "rb");
+    if (in == NULL) {
+        perror(name);
+        exit(1);
+    }
+    do {
+        if (len == *size) {
+            *size = *size ? *size << 1 : 65536L;
+            *buf = (Bytef *)realloc(*buf, (size_t)*size);
+            if (*buf == NULL) error("out of memory");
+        }
+        got = fread(*buf + len, 1, (size_t)(*size - len), in);
+        len += got;
+    } while (got);
+    if (ferror(in)) {
+        perror(name);
+        exit(1);
+    }
+    fclose(in);
+    return len - start;
+}
+
+/* ===========================================================================
+ * Return the length of data compressed in the zlib format at level, with the
+ * dictionary dict if dictLen is not zero.
+ */
+uLong compressed_size(data, len, level, dict, dictLen)
+    const Bytef *data;
+    uInt len;
+    int level;
+    const Bytef *dict;
+    uInt dictLen;
+{
+    z_stream strm;
+    Bytef out[16384];
+    uLong total;
+    int ret;
+
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    if (deflateInit(&strm, level) != Z_OK)
+        error("deflateInit failed");
+    if (dictLen && deflateSetDictionary(&strm, dict, dictLen) != Z_OK)
+        error("deflateSetDictionary failed");
+    strm.next_in = (z_const Bytef *)data;
+    strm.avail_in = len;
+    do {
+        strm.next_out = out;
+        strm.avail_out = sizeof(out);
+        ret = deflate(&strm, Z_FINISH);
+    } while (ret == Z_OK);
+    if (ret != Z_STREAM_END)
+        error("deflate failed");
+    total = strm.total_out;
+    deflateEnd(&strm);
+    return total;
+}
+
+/* ===========================================================================
+ * Usage:  minidict [-s size] [-1 to -9] sample...
+ *   -s size : build a dictionary of at most size bytes (default 32768)
+ *   -1 to -9 : compression level for the report (default 6)
+ */
+int main(argc, argv)
+    int argc;
+    char *argv[];
+{
+    Bytef *samples = NULL;
+    uInt *lengths;
+    uLong size = 0, total = 0, plain, with, sum = 0, sumdict = 0;
+    Bytef dict[MAX_DICT];
+    uInt dictLen = MAX_DICT;
+    z_stream strm;
+    int level = 6, n, i;
+    int ret;
+
+    prog = argv[0];
+    argc--, argv++;
+    while (argc > 0 && (*argv)[0] == '-') {
+        if (strcmp(*argv, "-s") == 0 && argc > 1) {
+            argc--, argv++;
+            dictLen = (uInt)atoi(*argv);
+            if (dictLen == 0 || dictLen > MAX_DICT)
+                error("dictionary size must be 1..32768");
+        }
+        else if ((*argv)[1] >= '1' && (*argv)[1] <= '9' && (*argv)[2] == 0)
+            level = (*argv)[1] - '0';
+        else
+            break;
+        argc--, argv++;
+    }
+    if (argc == 0) {
+        fprintf(stderr, "usage: %s [-s size] [-1 to -9] sample...\n", prog);
+        exit(1);
+    }
+
+    n = argc;
+    lengths = (uInt *)malloc(n * sizeof(uInt));
+    if (lengths == NULL) error("out of memory");
+    for (i = 0; i < n; i++) {
+        lengths[i] = (uInt)load(argv[i], &samples, &size, total);
+        total += lengths[i];
+    }
+
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateTrainDictionary(&strm, dict, &dictLen, samples, lengths,
+                                 (unsigned)n);
+    if (ret != Z_OK)
+        error(ret == Z_MEM_ERROR ? "out of memory" : "training failed");
+    if (dictLen == 0)
+        error("no strings in common between the samples");
+    SET_BINARY_MODE(stdout);
+    if (fwrite(dict, 1, dictLen, stdout) != dictLen || fflush(stdout))
+        error("write error");
+
+    /* report the gain for each sample */
+    fprintf(stderr, "dictionary: %u bytes from %d samples, %lu bytes\n",
+            dictLen, n, total);
+    total = 0;
+    for (i = 0; i < n; i++) {
+        plain = compressed_size(samples + total, lengths[i], level, dict, 0);
+        with = compressed_size(samples + total, lengths[i], level, dict,
+                               dictLen);
+        fprintf(stderr, "%s: %u -> %lu, with dictionary %lu (%.1f%%)\n",
+                argv[i], lengths[i], plain, with,
+                100.0 * ((double)plain - (double)with) / plain);
+        sum += plain;
+        sumdict += with;
+        total += lengths[i];
+    }
+    fprintf(stderr, "total: %lu -> %lu, with dictionary %lu (%.1f%%)\n",
+            total, sum, sumdict,
+            sum ? 100.0 * ((double)sum - (double)sumdict) / sum : 0.0);
+
+    free(lengths);
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,234 @@
+/* train.c -- build a preset dictionary from sample data
+ * Copyright (C) 2026 The Android Open Source Project
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+/* @(#) $Id$ */
+
+/*
+ *  ALGORITHM
+ *
+ *      A preset dictionary helps deflate only with strings that appear in
+ *      many of the messages compressed with it.  So the samples are scanned
+ *      once to count, for each string of TRAIN_DMER bytes, the number of
+ *      samples other than the first that contain it.  Then the samples are
+ *      cut into as many equal ranges ("epochs") as the dictionary has room
+ *      for segments of TRAIN_SEGMENT bytes, and the segment of each epoch
+ *      with the highest sum of counts over the distinct strings it contains
+ *      is selected.  The counts of the strings in a selected segment are
+ *      cleared, so that later segments do not repeat them.
+ *
+ *      The selected segments are written to the dictionary in order of
+ *      increasing value.  deflate codes short distances in fewer bits, and
+ *      the end of the dictionary is the closest to the data, so the most
+ *      useful strings are placed last.
+ *
+ *      This is the "cover" method of Liao, Petri, Moffat, and Wirth,
+ *      "Effective Construction of Relative Lempel-Ziv Dictionaries", with
+ *      hashed string counts so that the memory used is fixed.
+ */
+
+#include "zutil.h"
+
+#define TRAIN_DMER 6
+/* Length of the strings counted.  Strings shorter than this are usually
+ * coded as well by literals as by a match into the dictionary.
+ */
+
+#define TRAIN_SEGMENT 256
+/* Length of the segments copied to the dictionary. */
+
+#define TRAIN_MAX_BITS 20
+/* Maximum number of bits in the hash of the counted strings. */
+
+#define TRAIN_MAX_DICT 32768
+/* deflate cannot use a longer dictionary. */
+
+typedef struct segment_s {
+    uLong start;        /* offset of the segment in the samples */
+    uInt len;           /* length of the segment */
+    uLong score;        /* sum of the counts of its strings when selected */
+} segment;
+
+local uInt hash_dmer OF((const Bytef *p, int bits));
+
+/* ===========================================================================
+ * Return a hash of the TRAIN_DMER bytes at p, in [0, 1 << bits).
+ */
+local uInt hash_dmer(p, bits)
+    const Bytef *p;
+    int bits;
+{
+    ulg a, b;
+
+    a = (ulg)p[0] | ((ulg)p[1] << 8) | ((ulg)p[2] << 16) | ((ulg)p[3] << 24);
+    b = (ulg)p[4] | ((ulg)p[5] << 8);
+    a = ((a * 2654435761UL) ^ (b * 2246822519UL)) & 0xffffffffUL;
+    return (uInt)(a >> (32 - bits));
+}
+
+/* ========================================================================= */
+int ZEXPORT deflateTrainDictionary (strm, dictionary, dictLength,
+                                    samples, sampleLengths, nbSamples)
+    z_streamp strm;
+    Bytef *dictionary;
+    uInt *dictLength;
+    const Bytef *samples;
+    const uInt *sampleLengths;
+    unsigned nbSamples;
+{
+    uInt *count;            /* samples other than the first with a string */
+    uInt *seen;             /* last sample with a string, then the number of
+                               times a string is in the current window */
+    segment *segs;          /* the selected segments */
+    unsigned nsegs, n;      /* number of segments selected, index */
+    unsigned max;           /* maximum number of segments */
+    uLong total;            /* total length of the samples */
+    uLong epoch;            /* length of an epoch */
+    uLong beg, end;         /* current epoch */
+    uLong base;             /* offset of the current sample */
+    unsigned cur;           /* index of the current sample */
+    uLong a, b, j;          /* current sample range, current string */
+    uLong score;            /* score of the current window */
+    segment best;           /* best segment of this epoch */
+    uInt size, h;
+    int bits;
+
+    if (strm == Z_NULL || dictionary == Z_NULL || dictLength == Z_NULL ||
+        (samples == Z_NULL && nbSamples) || sampleLengths == Z_NULL)
+        return Z_STREAM_ERROR;
+    if (strm->zalloc == (alloc_func)0) {
+#ifdef Z_SOLO
+        return Z_STREAM_ERROR;
+#else
+        strm->zalloc = zcalloc;
+        strm->opaque = (voidpf)0;
+#endif
+    }
+    if (strm->zfree == (free_func)0)
+#ifdef Z_SOLO
+        return Z_STREAM_ERROR;
+#else
+        strm->zfree = zcfree;
+#endif
+
+    /* size the hash table for the total sample length */
+    size = *dictLength > TRAIN_MAX_DICT ? TRAIN_MAX_DICT : *dictLength;
+    *dictLength = 0;
+    total = 0;
+    for (n = 0; n < nbSamples; n++)
+        total += sampleLengths[n];
+    if (total < TRAIN_DMER || size == 0)
+        return Z_OK;
+    bits = 10;
+    while (bits < TRAIN_MAX_BITS && ((uLong)1 << bits) < (total << 1))
+        bits++;
+
+    max = (size + TRAIN_SEGMENT - 1) / TRAIN_SEGMENT;
+    count = (uInt *)ZALLOC(strm, 1U << bits, sizeof(uInt));
+    seen = (uInt *)ZALLOC(strm, 1U << bits, sizeof(uInt));
+    segs = (segment *)ZALLOC(strm, max, sizeof(segment));
+    if (count == Z_NULL || seen == Z_NULL || segs == Z_NULL) {
+        if (segs != Z_NULL) ZFREE(strm, segs);
+        if (seen != Z_NULL) ZFREE(strm, seen);
+        if (count != Z_NULL) ZFREE(strm, count);
+        return Z_MEM_ERROR;
+    }
+
+    /* count the number of samples that contain each string -- a string in
+       only one sample is worth nothing, so the first one is not counted */
+    zmemzero((Bytef *)count, (1U << bits) * sizeof(uInt));
+    zmemzero((Bytef *)seen, (1U << bits) * sizeof(uInt));
+    base = 0;
+    for (n = 0; n < nbSamples; n++) {
+        for (j = base; j + TRAIN_DMER <= base + sampleLengths[n]; j++) {
+            h = hash_dmer(samples + j, bits);
+            if (seen[h] != n + 1) {
+                if (seen[h])
+                    count[h]++;
+                seen[h] = n + 1;
+            }
+        }
+        base += sampleLengths[n];
+    }
+    zmemzero((Bytef *)seen, (1U << bits) * sizeof(uInt));
+
+    /* select the best segment in each epoch, scoring each window by the
+       counts of the distinct strings in it, kept in seen[] */
+    epoch = total / max;
+    if (epoch < TRAIN_SEGMENT)
+        epoch = TRAIN_SEGMENT;
+    nsegs = 0;
+    cur = 0;
+    base = 0;
+    for (beg = 0; beg < total && nsegs < max; beg = end) {
+        end = total - beg > epoch ? beg + epoch : total;
+        best.score = 0;
+        while (base < end) {
+            while (sampleLengths[cur] == 0 || base + sampleLengths[cur] <= beg) {
+                base += sampleLengths[cur];
+                cur++;
+            }
+            a = beg > base ? beg : base;
+            b = base + sampleLengths[cur] < end ? base + sampleLengths[cur] : end;
+            score = 0;
+            for (j = a; j + TRAIN_DMER <= b; j++) {
+                h = hash_dmer(samples + j, bits);
+                if (seen[h]++ == 0)
+                    score += count[h];
+                if (j >= a + TRAIN_SEGMENT - TRAIN_DMER + 1) {
+                    h = hash_dmer(samples + j - (TRAIN_SEGMENT - TRAIN_DMER + 1),
+                                  bits);
+                    if (--seen[h] == 0)
+                        score -= count[h];
+                }
+                if (score > best.score) {
+                    best.score = score;
+                    best.start = j >= a + TRAIN_SEGMENT - TRAIN_DMER ?
+                                 j - (TRAIN_SEGMENT - TRAIN_DMER) : a;
+                    best.len = (uInt)(j + TRAIN_DMER - best.start);
+                }
+            }
+
+            /* empty the window */
+            j = b - a >= TRAIN_SEGMENT ? b - TRAIN_SEGMENT : a;
+            for (; j + TRAIN_DMER <= b; j++)
+                seen[hash_dmer(samples + j, bits)]--;
+            if (b == end)
+                break;
+            base += sampleLengths[cur];
+            cur++;
+        }
+        if (best.score == 0)
+            continue;
+
+        /* keep the segment and clear the counts of its strings */
+        segs[nsegs++] = best;
+        for (j = best.start; j + TRAIN_DMER <= best.start + best.len; j++)
+            count[hash_dmer(samples + j, bits)] = 0;
+    }
+
+    /* sort the segments by increasing score (insertion sort -- there are at
+       most 128), and write them to the dictionary in that order,
+       dropping the lowest scores if they do not all fit */
+    for (n = 1; n < nsegs; n++) {
+        best = segs[n];
+        for (h = n; h && segs[h - 1].score > best.score; h--)
+            segs[h] = segs[h - 1];
+        segs[h] = best;
+    }
+    a = 0;
+    n = nsegs;
+    while (n && a + segs[n - 1].len <= size)
+        a += segs[--n].len;
+    for (; n < nsegs; n++) {
+        zmemcpy(dictionary + *dictLength, samples + segs[n].start,
+                segs[n].len);
+        *dictLength += segs[n].len;
+    }
+
+    ZFREE(strm, segs);
+    ZFREE(strm, seen);
+    ZFREE(strm, count);
+    return Z_OK;
+}
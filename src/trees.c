@@ -63,7 +63,11 @@ local const int extra_lbits[LENGTH_CODES] /* extra bits for each length code */
    = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
 
 local const int extra_dbits[D_CODES] /* extra bits for each distance code */
-   = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+   = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13
+#ifdef DEFLATE64
+      ,14,14
+#endif
+     };
 
 local const int extra_blbits[BL_CODES]/* extra bits for each bit length code */
    = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,7};
@@ -78,10 +82,15 @@ local const uch bl_order[BL_CODES]
  * Local data. These are initialized only once.
  */
 
-#define DIST_CODE_LEN  512 /* see definition of array dist_code below */
+#ifdef DEFLATE64
+#  define DIST_CODE_LEN  768 /* distances up to 64K */
+#else
+#  define DIST_CODE_LEN  512 /* see definition of array dist_code below */
+#endif
 
-#if defined(GEN_TREES_H) || !defined(STDC)
-/* non ANSI compilers may not accept trees.h */
+#if defined(GEN_TREES_H) || !defined(STDC) || defined(DEFLATE64)
+/* non ANSI compilers may not accept trees.h, which is only for 30 distance
+ * codes */
 
 local ct_data static_ltree[L_CODES+2];
 /* The static literal tree. Since the bit lengths are imposed, there is no
@@ -98,7 +107,7 @@ local ct_data static_dtree[D_CODES];
 uch _dist_code[DIST_CODE_LEN];
 /* Distance codes. The first 256 values correspond to the distances
  * 3 .. 258, the last 256 values correspond to the top 8 bits of
- * the 15 bit distances.
+ * the 15 bit distances (512 values for the 16 bit distances of deflate64).
  */
 
 uch _length_code[MAX_MATCH-MIN_MATCH+1];
@@ -233,7 +242,7 @@ local void send_bits(s, value, length)
  */
 local void tr_static_init()
 {
-#if defined(GEN_TREES_H) || !defined(STDC)
+#if defined(GEN_TREES_H) || !defined(STDC) || defined(DEFLATE64)
     static int static_init_done = 0;
     int n;        /* iterates over tree elements */
     int bits;     /* bit counter */
@@ -285,7 +294,8 @@ local void tr_static_init()
             _dist_code[256 + dist++] = (uch)code;
         }
     }
-    Assert (dist == 256, "tr_static_init: 256+dist != 512");
+    Assert (dist == DIST_CODE_LEN - 256,
+            "tr_static_init: 256+dist != DIST_CODE_LEN");
 
     /* Construct the codes of the static literal tree */
     for (bits = 0; bits <= MAX_BITS; bits++) bl_count[bits] = 0;
@@ -310,7 +320,7 @@ local void tr_static_init()
 #  ifdef GEN_TREES_H
     gen_trees_header();
 #  endif
-#endif /* defined(GEN_TREES_H) || !defined(STDC) */
+#endif /* defined(GEN_TREES_H) || !defined(STDC) || defined(DEFLATE64) */
 }
 
 /* ===========================================================================
@@ -913,6 +923,8 @@ void ZLIB_INTERNAL _tr_flush_block(s, buf, stored_len, last)
     ulg opt_lenb, static_lenb; /* opt_len and static_len in bytes */
     int max_blindex = 0;  /* index of last bit length code of non zero freq */
 
+    s->last_stored = 0;
+
     /* Build the Huffman trees unless a stored block is forced */
     if (s->level > 0) {
 
@@ -965,6 +977,7 @@ void ZLIB_INTERNAL _tr_flush_block(s, buf, stored_len, last)
          * transform a block into a stored block.
          */
         _tr_stored_block(s, buf, stored_len, last);
+        s->last_stored = stored_len;
 
 #ifdef FORCE_STATIC
     } else if (static_lenb >= 0) { /* force static trees */
@@ -1025,7 +1038,7 @@ int ZLIB_INTERNAL _tr_tally (s, dist, lc)
                (ush)lc <= (ush)(MAX_MATCH-MIN_MATCH) &&
                (ush)d_code(dist) < (ush)D_CODES,  "_tr_tally: bad match");
 
-        s->dyn_ltree[_length_code[lc]+LITERALS+1].Freq++;
+        s->dyn_ltree[l_code(s, lc)+LITERALS+1].Freq++;
         s->dyn_dtree[d_code(dist)].Freq++;
     }
 
@@ -1054,6 +1067,48 @@ int ZLIB_INTERNAL _tr_tally (s, dist, lc)
      */
 }
 
+/* ===========================================================================
+ * Save len unmatched chars from buf and update the literal tree.  Return
+ * true if the current block must be flushed.  The caller must make sure that
+ * the literals fit, i.e. that last_lit + len <= lit_bufsize - 1.
+ */
+int ZLIB_INTERNAL _tr_tally_lits (s, buf, len)
+    deflate_state *s;
+    const uchf *buf; /* unmatched chars */
+    unsigned len;    /* number of chars */
+{
+    unsigned n;             /* iterates over buf */
+    unsigned freq[2][256];  /* interleaved counts */
+
+    Assert(s->last_lit + len <= s->lit_bufsize - 1, "_tr_tally_lits: overrun");
+#ifdef DEBUG
+    for (n = 0; n < len; n++)
+        Tracevv((stderr,"%c", buf[n]));
+#endif
+    zmemcpy(s->l_buf + s->last_lit, buf, len);
+    zmemzero((Bytef *)(s->d_buf + s->last_lit), len * sizeof(ush));
+    s->last_lit += len;
+
+    if (len < 512) {
+        while (len--)
+            s->dyn_ltree[*buf++].Freq++;
+    }
+    else {
+        /* Count into two tables, so that runs of the same byte do not wait on
+           the previous increment, then add the counts to the tree. */
+        zmemzero((Bytef *)freq, sizeof(freq));
+        for (n = 0; n + 1 < len; n += 2) {
+            freq[0][buf[n]]++;
+            freq[1][buf[n + 1]]++;
+        }
+        if (n < len)
+            freq[0][buf[n]]++;
+        for (n = 0; n < LITERALS; n++)
+            s->dyn_ltree[n].Freq += (ush)(freq[0][n] + freq[1][n]);
+    }
+    return (s->last_lit == s->lit_bufsize-1);
+}
+
 /* ===========================================================================
  * Send the block data compressed using the given Huffman trees
  */
@@ -1076,7 +1131,7 @@ local void compress_block(s, ltree, dtree)
             Tracecv(isgraph(lc), (stderr," '%c' ", lc));
         } else {
             /* Here, lc is the match length - MIN_MATCH */
-            code = _length_code[lc];
+            code = l_code(s, lc);
             send_code(s, code+LITERALS+1, ltree); /* send the length code */
             extra = extra_lbits[code];
             if (extra != 0) {
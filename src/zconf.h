@@ -29,6 +29,10 @@
 #  define adler32               z_adler32
 #  define adler32_combine       z_adler32_combine
 #  define adler32_combine64     z_adler32_combine64
+#  define adler32_combine_gen   z_adler32_combine_gen
+#  define adler32_combine_gen64 z_adler32_combine_gen64
+#  define adler32_combine_op    z_adler32_combine_op
+#  define adler32_copy          z_adler32_copy
 #  ifndef Z_SOLO
 #    define compress              z_compress
 #    define compress2             z_compress2
@@ -37,20 +41,34 @@
 #  define crc32                 z_crc32
 #  define crc32_combine         z_crc32_combine
 #  define crc32_combine64       z_crc32_combine64
+#  define crc32_combine_gen     z_crc32_combine_gen
+#  define crc32_combine_gen64   z_crc32_combine_gen64
+#  define crc32_combine_op      z_crc32_combine_op
+#  define crc32_copy            z_crc32_copy
 #  define deflate               z_deflate
+#  define deflateAccessPoints   z_deflateAccessPoints
+#  define deflateBatch          z_deflateBatch
 #  define deflateBound          z_deflateBound
 #  define deflateCopy           z_deflateCopy
 #  define deflateEnd            z_deflateEnd
+#  define deflateFreeDictionary z_deflateFreeDictionary
 #  define deflateInit2_         z_deflateInit2_
 #  define deflateInit_          z_deflateInit_
 #  define deflateParams         z_deflateParams
 #  define deflatePending        z_deflatePending
 #  define deflatePrime          z_deflatePrime
+#  define deflatePrepareDictionary z_deflatePrepareDictionary
 #  define deflateReset          z_deflateReset
 #  define deflateResetKeep      z_deflateResetKeep
+#  define deflateRestore        z_deflateRestore
+#  define deflateRsyncable      z_deflateRsyncable
+#  define deflateSave           z_deflateSave
 #  define deflateSetDictionary  z_deflateSetDictionary
 #  define deflateSetHeader      z_deflateSetHeader
+#  define deflateTrainDictionary z_deflateTrainDictionary
 #  define deflateTune           z_deflateTune
+#  define deflateV              z_deflateV
+#  define deflateUseDictionary  z_deflateUseDictionary
 #  define deflate_copyright     z_deflate_copyright
 #  define get_crc_table         z_get_crc_table
 #  ifndef Z_SOLO
@@ -95,6 +113,7 @@
 #  define inflateBack           z_inflateBack
 #  define inflateBackEnd        z_inflateBackEnd
 #  define inflateBackInit_      z_inflateBackInit_
+#  define inflateBatch          z_inflateBatch
 #  define inflateCopy           z_inflateCopy
 #  define inflateEnd            z_inflateEnd
 #  define inflateGetHeader      z_inflateGetHeader
@@ -104,11 +123,18 @@
 #  define inflatePrime          z_inflatePrime
 #  define inflateReset          z_inflateReset
 #  define inflateReset2         z_inflateReset2
+#  define inflateRestore        z_inflateRestore
+#  define inflateRing           z_inflateRing
+#  define inflateSave           z_inflateSave
+#  define inflateValidate       z_inflateValidate
 #  define inflateSetDictionary  z_inflateSetDictionary
 #  define inflateGetDictionary  z_inflateGetDictionary
 #  define inflateSync           z_inflateSync
+#  define inflateSyncFind       z_inflateSyncFind
 #  define inflateSyncPoint      z_inflateSyncPoint
 #  define inflateUndermine      z_inflateUndermine
+#  define inflateUseDictionary  z_inflateUseDictionary
+#  define inflateV              z_inflateV
 #  define inflateResetKeep      z_inflateResetKeep
 #  define inflate_copyright     z_inflate_copyright
 #  define inflate_fast          z_inflate_fast
@@ -128,6 +128,46 @@ typedef struct gz_header_s {
 
 typedef gz_header FAR *gz_headerp;
 
+struct z_dict_s;
+typedef struct z_dict_s FAR *z_dictp;
+/*
+     A preset dictionary prepared by deflatePrepareDictionary() for use by
+   deflateUseDictionary().  The contents are not visible by applications.
+*/
+
+/*
+     Random access point passed by deflate() to the function provided to
+  deflateAccessPoints().  Decompression can start at the point, with raw
+  inflate, by priming with the bits of the byte before out and setting the
+  window as the dictionary.  See examples/zran.c.
+*/
+typedef struct z_point_s {
+    uLong   in;         /* offset of the point in the uncompressed data */
+    uLong   out;        /* offset of the first whole byte after the point in
+                           the compressed data, including any header */
+    int     bits;       /* number of bits (1..7) after the point in the byte
+                           before out, or 0 */
+    z_const Bytef *window;  /* uncompressed data just before in */
+    uInt    window_len; /* length of window, up to the window size, or zero
+                           if none is needed, after a full flush */
+} z_point;
+
+typedef z_point FAR *z_pointp;
+
+typedef int (*point_func) OF((void FAR *, z_pointp));
+
+/*
+     Segment of scattered input or output for deflateV() and inflateV().  The
+  segments are used in order, and base and len are advanced as the segment is
+  consumed or filled.  Input segments are not written to.
+*/
+typedef struct z_vec_s {
+    Bytef   *base;      /* next byte of the segment */
+    uInt    len;        /* number of bytes left in the segment */
+} z_vec;
+
+typedef z_vec FAR *z_vecp;
+
 /*
      The application must update next_in and avail_in when avail_in has dropped
    to zero.  It must update next_out and avail_out when avail_out has dropped
@@ -205,6 +245,10 @@ typedef gz_header FAR *gz_headerp;
 #define Z_DEFLATED   8
 /* The deflate compression method (the only one supported in this version) */
 
+#define Z_DEFLATED64 9
+/* The deflate64 compression method, only for raw deflate() when zlib is
+   compiled with DEFLATE64 defined, see deflateInit2() below */
+
 #define Z_NULL  0  /* for initializing zalloc, zfree, opaque */
 
 #define zlib_version zlibVersion()
@@ -536,7 +580,13 @@ ZEXTERN int ZEXPORT deflateInit2 OF((z_streamp strm,
    caller.
 
      The method parameter is the compression method.  It must be Z_DEFLATED in
-   this version of the library.
+   this version of the library, unless zlib was compiled with DEFLATE64
+   defined.  Then it can also be Z_DEFLATED64 for raw deflate (negative
+   windowBits), in which case windowBits can be -16 for a 64K window.
+   deflate() then generates PKWare's deflate64 (zip method 9), which can be
+   decoded by inflateBack9() in contrib/infback9 but not by inflate().
+   Matches are limited to 258 bytes, as for deflate.  The DEFLATE64 build
+   uses twice the memory for the hash tables for all streams.
 
      The windowBits parameter is the base two logarithm of the window size
    (the size of the history buffer).  It should be in the range 8..15 for this
@@ -628,6 +678,74 @@ ZEXTERN int ZEXPORT deflateSetDictionary OF((z_streamp strm,
    not perform any compression: this will be done by deflate().
 */
 
+ZEXTERN int ZEXPORT deflatePrepareDictionary OF((z_streamp strm,
+                                                 const Bytef *dictionary,
+                                                 uInt  dictLength,
+                                                 z_dictp *dict));
+ZEXTERN int ZEXPORT deflateUseDictionary OF((z_streamp strm,
+                                             z_dictp dict));
+ZEXTERN int ZEXPORT deflateFreeDictionary OF((z_streamp strm,
+                                              z_dictp dict));
+/*
+     deflatePrepareDictionary() does the work of deflateSetDictionary() once,
+   saving the result in a new *dict that any number of streams can then use
+   with deflateUseDictionary(), for example to compress many short messages
+   with the same dictionary.  The dictionary is copied, so it can be freed or
+   changed after the call.  strm is only used for its windowBits and memLevel,
+   which must be the same for the streams that use *dict, and for its memory
+   allocation functions.  deflatePrepareDictionary() does not change the state
+   of strm.
+
+     deflateUseDictionary() gives strm the same state as deflateSetDictionary()
+   with the original dictionary, and the compressed output is the same.  It
+   copies the window and hash tables from dict instead of building them.  It
+   must be called immediately after deflateInit, deflateInit2 or deflateReset,
+   before any call of deflate() or deflateSetDictionary(), for the zlib or raw
+   deflate format.  dict is only read, so it can be used concurrently by
+   streams in different threads.  strm->adler is set as for
+   deflateSetDictionary().
+
+     deflateFreeDictionary() frees dict using the allocation functions of strm,
+   which must be the same as those used by deflatePrepareDictionary().  The
+   streams using dict do not refer to it after deflateUseDictionary() returns.
+
+     These functions return Z_OK if success, Z_MEM_ERROR if there was not enough
+   memory, or Z_STREAM_ERROR if a parameter is invalid or the stream state is
+   inconsistent, or if windowBits or memLevel of strm do not match those used
+   to prepare dict.
+*/
+
+ZEXTERN int ZEXPORT deflateTrainDictionary OF((z_streamp strm,
+                                               Bytef *dictionary,
+                                               uInt  *dictLength,
+                                               const Bytef *samples,
+                                               const uInt *sampleLengths,
+                                               unsigned nbSamples));
+/*
+     Builds a preset dictionary for deflateSetDictionary() from samples of the
+   data that will be compressed with it.  samples holds the nbSamples samples
+   one after another, with the length of each in sampleLengths.  On entry,
+   *dictLength is the size of the dictionary buffer, and on return it is the
+   length of the dictionary written there, which is at most 32768 bytes.
+
+     The dictionary is made of the strings that appear in the most samples,
+   with the most valuable strings at the end, where the distances to them are
+   the shortest.  It is useful only for strings that recur across samples, so
+   training on a few hundred samples that are representative of the messages
+   to be compressed works best.  The result is not useful if the samples total
+   less than a few times *dictLength, in which case the samples themselves
+   may be the better dictionary.
+
+     strm is only used for its zalloc, zfree and opaque fields, which are
+   set as for deflateInit() and may be Z_NULL for the default allocation
+   functions.  The stream need not be initialized, and it is not changed
+   otherwise.  The memory used is at most about eight megabytes.
+
+     deflateTrainDictionary returns Z_OK if success, Z_MEM_ERROR if there was
+   not enough memory, or Z_STREAM_ERROR if a parameter is Z_NULL.  *dictLength
+   is set to zero if no string appears in more than one sample.
+*/
+
 ZEXTERN int ZEXPORT deflateCopy OF((z_streamp dest,
                                     z_streamp source));
 /*
@@ -646,6 +764,54 @@ ZEXTERN int ZEXPORT deflateCopy OF((z_streamp dest,
    destination.
 */
 
+ZEXTERN int ZEXPORT deflateSave OF((z_streamp strm,
+                                    Bytef *buf,
+                                    uLong *len));
+/*
+     Writes a checkpoint of the compression state at buf, from which
+   deflateRestore() can resume compression later, in another stream or in
+   another process or on another machine.  The checkpoint is a compact,
+   portable sequence of bytes that holds the parameters, the bit buffer, the
+   check value, and up to the last 32K bytes of uncompressed data as history
+   for later matches.  The hash tables are not saved.  If buf is Z_NULL, *len
+   is set to the number of bytes needed, at most 32K plus 124.  Otherwise *len
+   is the space at buf on entry, and is set to the number of bytes written.
+
+     A checkpoint can only be made between deflate blocks with no compressed
+   data pending, as after a call of deflate() with a flush parameter other
+   than Z_NO_FLUSH or Z_FINISH that did not fill the output buffer, or before
+   any compression.  After Z_BLOCK, up to seven bits of the last block that do
+   not fill a byte are not written, and are in the checkpoint instead.  Not
+   saved are the gzip header (deflateSetHeader), the access point callback
+   (deflateAccessPoints), and any memory level or allocation functions, which
+   are those of the restoring stream.
+
+     deflateSave returns Z_OK if success, Z_BUF_ERROR if *len is not large
+   enough, in which case *len is set to the number of bytes needed, or
+   Z_STREAM_ERROR if the stream state was inconsistent or the stream is not
+   between blocks with nothing pending.
+*/
+
+ZEXTERN int ZEXPORT deflateRestore OF((z_streamp strm,
+                                       const Bytef *buf,
+                                       uLong len));
+/*
+     Resumes compression from the len-byte checkpoint at buf written by
+   deflateSave().  strm must have been initialized with deflateInit2() with
+   the same windowBits as the saved stream, and any memLevel.  Compression
+   then continues with the saved level, strategy, and check value, as if the
+   saved stream were continued, with the data that follows given to deflate().
+   The output can differ slightly from that of an uninterrupted stream, since
+   the history is hashed anew, but is a valid continuation of the compressed
+   data written before the checkpoint.  A gzip header to write before any
+   compression must be provided again with deflateSetHeader(), and access
+   points again with deflateAccessPoints() before deflateRestore().
+
+     deflateRestore returns Z_OK if success, Z_DATA_ERROR if buf does not hold
+   a valid checkpoint, or Z_STREAM_ERROR if the stream state was inconsistent
+   or windowBits is not the same.  strm is unchanged if an error is returned.
+*/
+
 ZEXTERN int ZEXPORT deflateReset OF((z_streamp strm));
 /*
      This function is equivalent to deflateEnd followed by deflateInit,
@@ -695,6 +861,111 @@ ZEXTERN int ZEXPORT deflateTune OF((z_streamp strm,
    returns Z_OK on success, or Z_STREAM_ERROR for an invalid deflate stream.
  */
 
+ZEXTERN int ZEXPORT deflateRsyncable OF((z_streamp strm,
+                                         int bits));
+/*
+     Makes the compressed output friendly to rsync and to block deduplication,
+   or turns that off if bits is zero.  Normally a change in the input changes
+   all of the compressed data that follows it.  In rsyncable mode, deflate()
+   picks points in the input based on a rolling hash of the last few bytes,
+   and does a Z_FULL_FLUSH at each point.  Since the points depend only on the
+   nearby input, the compressed data after a change is the same as before the
+   change, starting from the first point that is at least one point past the
+   change.  The points are on average about 2^bits bytes apart, and at least
+   2^(bits-4) bytes apart.  bits must be in 8..24, and 12 is a good choice.
+   The cost is a small loss of compression, about 5 bytes per point plus the
+   history that is forgotten.
+
+     In rsyncable mode, the input not consumed by deflate() must be provided
+   again at next_in on the next call, as is normally done.  deflateRsyncable()
+   can be called at any time, and the setting is kept by deflateReset().
+   deflateBound() takes the extra flushes into account.
+
+     deflateRsyncable returns Z_OK on success, or Z_STREAM_ERROR if the stream
+   state is inconsistent or bits is invalid.
+*/
+
+ZEXTERN int ZEXPORT deflateAccessPoints OF((z_streamp strm,
+                                            uLong span, int full,
+                                            point_func point,
+                                            void FAR *point_desc));
+/*
+     Requests that deflate() report random access points in the compressed
+   data as it is produced, so that an index for random access can be built
+   without decompressing the output again, or turns that off if span is zero
+   or point is Z_NULL.  At each access point, deflate() calls point(point_desc,
+   here), where here describes the access point as documented for z_point.
+   here->window is valid only until point() returns.  If point() returns
+   non-zero, then no more access points are reported.
+
+     If full is false, then an access point is reported at the first deflate
+   block boundary that is span or more bytes of uncompressed data after the
+   previous point, with the preceding window of uncompressed data, which is
+   needed to decompress from that point.  The compressed data is the same as
+   without access points.  If full is true, then a Z_FULL_FLUSH is done every
+   span bytes of uncompressed data, and the access point after each flush is
+   reported with no window, at the cost of about 5 bytes per point plus the
+   history that is forgotten.  deflateBound() takes those flushes into
+   account.
+
+     The offsets are from the start of the stream, and there is no access
+   point at the start of the stream or after the last block.
+   deflateAccessPoints() can be called at any time, where span is counted from
+   the current input, and the setting is kept by deflateReset().
+
+     deflateAccessPoints returns Z_OK on success, or Z_STREAM_ERROR if the
+   stream state is inconsistent.
+*/
+
+ZEXTERN int ZEXPORT deflateV OF((z_streamp strm,
+                                 z_vecp in, unsigned nin,
+                                 z_vecp out, unsigned nout,
+                                 int flush));
+/*
+     Compresses the nin segments of input at in to the nout segments of output
+   at out, as if the input were one buffer provided to deflate() with avail_in
+   the total of the input lengths and the output one buffer with avail_out the
+   total of the output lengths.  This avoids copying fragmented input into one
+   buffer, or writing a loop over the fragments.  flush applies after the last
+   input segment, and is as for deflate().
+
+     On return, the base and len of each segment are advanced past the input
+   consumed or the output written, so that the segments with len zero are done
+   with.  As for deflate(), deflateV() must be called again with more output
+   segments if the output segments are all filled, until the flush is complete.
+   next_in, avail_in, next_out, and avail_out in strm are used by deflateV(),
+   and are left pointing into the last segments used.
+
+     deflateV returns the value returned by the last call of deflate(), or
+   Z_BUF_ERROR if no progress was possible, or Z_STREAM_ERROR if a segment
+   array is Z_NULL for a non-zero number of segments.
+*/
+
+ZEXTERN int ZEXPORT deflateBatch OF((z_streamp strm, z_dictp dict,
+                                     Bytef * const *dest, uLongf *destLen,
+                                     const Bytef * const *source,
+                                     const uLong *sourceLen, unsigned n));
+/*
+     Compresses each of the n records source[i] of length sourceLen[i] on its
+   own to dest[i], as if by deflateReset() and deflate() with Z_FINISH.  On
+   entry, destLen[i] is the size of dest[i], and on exit it is the length of
+   the compressed record, or zero if the record did not fit.  strm is set up
+   as for deflate() with deflateInit() or deflateInit2(), whose parameters
+   apply to every record, and is reset before each record.  If dict is not
+   Z_NULL, then each record is compressed with that dictionary, as prepared by
+   deflatePrepareDictionary().
+
+     This is much faster than compress2() for many short records, since the
+   memory is allocated once, and only the part of the hash table used by the
+   last record is cleared for the next one.  A large batch can be split among
+   threads, each with its own strm, since dict is only read.
+
+     deflateBatch returns Z_OK if success, Z_BUF_ERROR if any of the records
+   did not fit, in which case the others are still compressed, or
+   Z_STREAM_ERROR if the stream state was inconsistent, an array is Z_NULL,
+   or dict does not match the parameters of strm.
+*/
+
 ZEXTERN uLong ZEXPORT deflateBound OF((z_streamp strm,
                                        uLong sourceLen));
 /*
@@ -839,6 +1110,53 @@ ZEXTERN int ZEXPORT inflateSetDictionary OF((z_streamp strm,
    inflate().
 */
 
+ZEXTERN int ZEXPORT inflateUseDictionary OF((z_streamp strm,
+                                             const Bytef *dictionary,
+                                             uInt  dictLength));
+/*
+     Like inflateSetDictionary(), but refers to the provided dictionary in
+   place instead of copying it into the sliding window.  This is faster when
+   the same dictionary is used to decompress many short streams.  The
+   dictionary must remain unchanged until the stream is reset or ended, since
+   it is read by inflate().  If inflate() needs to keep a window between calls,
+   the part of the dictionary still in use is copied to the window at that
+   time -- this does not happen if each stream is decompressed with a single
+   call of inflate() with Z_FINISH.
+
+     inflateUseDictionary() must be called immediately after a call of inflate
+   that returned Z_NEED_DICT for the zlib format, or before any call of inflate
+   for raw inflate.  It returns the same values as inflateSetDictionary().
+*/
+
+ZEXTERN int ZEXPORT inflateRing OF((z_streamp strm,
+                                    Bytef *ring,
+                                    unsigned size));
+/*
+     Uses the size bytes at ring both as the output buffer and as the sliding
+   window of inflate, so that each byte of decompressed data is written only
+   once.  Otherwise inflate() also copies the output to its own window on
+   return, to keep the last 32K bytes for matches in later calls.  size must
+   be more than the window size, 1 << windowBits, and every byte more than that
+   is how much one call of inflate() can write.  For example, a 48K ring with
+   a 32K window lets each call write up to 16K bytes.
+
+     inflate() writes in place in the ring when next_out is where the last
+   inflate() call left it, which is at ring at first, and at ring again when
+   next_out reaches ring + size.  avail_out can be up to the rest of the ring.
+   Then inflate() does not write more than would overwrite the window, and
+   returns with the remainder of avail_out unused.  The data written by each
+   call remains in the ring until later calls write over it, size bytes on.
+   If next_out is anywhere else, inflate() works as usual, using the ring as
+   its window.  The ring is used until the stream is reset or ended, or a
+   checkpoint is restored, and must not be written to by the application
+   while it is in use.  inflateCopy() makes a copy that uses the same ring.
+
+     inflateRing() must be called before any call of inflate() after
+   inflateInit2() or a reset, and not with inflateUseDictionary().  It returns
+   Z_OK if success, or Z_STREAM_ERROR if a parameter is invalid (such as ring
+   being Z_NULL or size too small) or the stream state is not as required.
+*/
+
 ZEXTERN int ZEXPORT inflateGetDictionary OF((z_streamp strm,
                                              Bytef *dictionary,
                                              uInt  *dictLength));
@@ -873,6 +1191,26 @@ ZEXTERN int ZEXPORT inflateSync OF((z_streamp strm));
    input each time, until success or end of the input data.
 */
 
+ZEXTERN uInt ZEXPORT inflateSyncFind OF((const Bytef *buf, uInt len,
+                                         unsigned *have));
+/*
+     Searches buf[0..len-1] for the 00 00 FF FF pattern that inflateSync looks
+   for, without needing an inflate stream.  This can be used to find possible
+   full flush points in compressed data before or without decompressing it.
+   *have is the number of bytes of the pattern matched at the end of the
+   previous buffer, and must be set to zero before the first call.  This
+   allows the data to be searched in pieces, with a pattern split across
+   pieces found in the piece it ends in.
+
+     inflateSyncFind returns the number of bytes of buf up to and including
+   the end of the first pattern found, with *have set to four, in which case
+   the next deflate block would start right after that.  Otherwise all of buf
+   is searched, len is returned, and *have is set to the number of pattern
+   bytes at the end of buf, from zero to three, for the next call.  If *have
+   is four on entry, as after a pattern was found, then the search starts
+   over.  As for inflateSync, not every pattern found is a flush point.
+*/
+
 ZEXTERN int ZEXPORT inflateCopy OF((z_streamp dest,
                                     z_streamp source));
 /*
@@ -889,6 +1227,45 @@ ZEXTERN int ZEXPORT inflateCopy OF((z_streamp dest,
    destination.
 */
 
+ZEXTERN int ZEXPORT inflateSave OF((z_streamp strm,
+                                    Bytef *buf,
+                                    uLong *len));
+/*
+     Writes a checkpoint of the decompression state at buf, from which
+   inflateRestore() can resume decompression later, in another stream or in
+   another process or on another machine.  The checkpoint is a compact,
+   portable sequence of bytes that holds the bit buffer, the window contents
+   in use, the code lengths that the code tables are built from, and the check
+   value.  It can be made between any two calls of inflate(), and is much
+   smaller than an inflate state early in a stream or with a small window.  If
+   buf is Z_NULL, *len is set to the number of bytes needed, at most 32K plus
+   460.  Otherwise *len is the space at buf on entry, and is set to the number
+   of bytes written.  The gzip header destination (inflateGetHeader) is not
+   saved.
+
+     inflateSave returns Z_OK if success, Z_BUF_ERROR if *len is not large
+   enough, in which case *len is set to the number of bytes needed, or
+   Z_STREAM_ERROR if the stream state was inconsistent or inflate() has
+   returned an error.
+*/
+
+ZEXTERN int ZEXPORT inflateRestore OF((z_streamp strm,
+                                       const Bytef *buf,
+                                       uLong len));
+/*
+     Resumes decompression from the len-byte checkpoint at buf written by
+   inflateSave(), for any initialized inflate stream.  inflate() then
+   continues with the compressed data that follows what the saved stream had
+   consumed, which is strm->total_in bytes from the start, as restored.  The
+   window is allocated if it is needed and is not the saved size.
+
+     inflateRestore returns Z_OK if success, Z_MEM_ERROR if there was not
+   enough memory, Z_DATA_ERROR if buf does not hold a valid checkpoint, or
+   Z_STREAM_ERROR if the stream state was inconsistent.  After an error other
+   than Z_STREAM_ERROR, inflate() returns the same error until the stream is
+   reset, and msg is set for Z_DATA_ERROR.
+*/
+
 ZEXTERN int ZEXPORT inflateReset OF((z_streamp strm));
 /*
      This function is equivalent to inflateEnd followed by inflateInit,
@@ -911,6 +1288,25 @@ ZEXTERN int ZEXPORT inflateReset2 OF((z_streamp strm,
    the windowBits parameter is invalid.
 */
 
+ZEXTERN int ZEXPORT inflateValidate OF((z_streamp strm, int check));
+/*
+     If check is zero, then inflate() will not compute or compare the check
+   value of a zlib or gzip stream, i.e. the Adler-32 or CRC-32 of the
+   uncompressed data and the CRC-16 of a gzip header.  The wrapper is still
+   decoded, and the gzip trailer length is still checked.  This saves a pass
+   over the uncompressed data, but corrupted data may then go undetected, so
+   it should only be used when the compressed data is known to be intact, for
+   example when it is protected by a stronger check elsewhere.  strm->adler is
+   not updated while the check is not being computed.  If check is not zero,
+   then the check value is computed and compared, which is the default.
+
+     inflateValidate may be called at any time, but the check value will be
+   wrong if computing is turned on part way through the data.  The setting is
+   kept by inflateReset, and restored to the default by inflateReset2 and
+   inflateInit2.  It has no effect on raw inflate.  inflateValidate returns
+   Z_OK, or Z_STREAM_ERROR if the stream state was inconsistent.
+*/
+
 ZEXTERN int ZEXPORT inflatePrime OF((z_streamp strm,
                                      int bits,
                                      int value));
@@ -1000,6 +1396,54 @@ ZEXTERN int ZEXPORT inflateGetHeader OF((z_streamp strm,
    stream state was inconsistent.
 */
 
+ZEXTERN int ZEXPORT inflateV OF((z_streamp strm,
+                                 z_vecp in, unsigned nin,
+                                 z_vecp out, unsigned nout,
+                                 int flush));
+/*
+     Decompresses the nin segments of input at in to the nout segments of
+   output at out, as if the input and the output were each one buffer provided
+   to inflate().  The segments are advanced on return as for deflateV().
+   flush applies to the last input segment, and is as for inflate().  If flush
+   is Z_BLOCK or Z_TREES, then inflateV() returns at the first block boundary
+   as inflate() would.
+
+     inflateV returns the value returned by the last call of inflate(), which
+   is Z_STREAM_END if the end of the compressed data was reached, or
+   Z_BUF_ERROR if no progress was possible, or Z_STREAM_ERROR if a segment
+   array is Z_NULL for a non-zero number of segments.
+*/
+
+ZEXTERN int ZEXPORT inflateBatch OF((z_streamp strm,
+                                     const Bytef *dictionary, uInt dictLength,
+                                     Bytef * const *dest, uLongf *destLen,
+                                     const Bytef * const *source,
+                                     const uLong *sourceLen,
+                                     int *status, unsigned n));
+/*
+     Decompresses each of the n records source[i] of length sourceLen[i] on
+   its own to dest[i], as uncompress() would, but with the raw, zlib, or gzip
+   format, or automatic detection, as requested by the windowBits given to
+   inflateInit2() for strm.  On entry, destLen[i] is the size of dest[i], and
+   on exit it is the length of the decompressed record, or zero if the record
+   could not be decompressed.  If status is not Z_NULL, then status[i] is set
+   to Z_OK for each record decompressed, or else to the error that
+   uncompress() would return for it.  If dictionary is not Z_NULL, then it is
+   used for raw records and for zlib records that ask for it.  It is used in
+   place, as for inflateUseDictionary(), and is not needed after
+   inflateBatch() returns.
+
+     This is faster than uncompress() for many short records, since the
+   state is allocated once, and no window is allocated for the records that
+   fit in their dest[i].  A large batch can be split among threads, each with
+   its own strm.  strm is left as by inflateReset().
+
+     inflateBatch returns Z_OK if success, or the error for the first record
+   that failed, in which case the others are still decompressed, or
+   Z_MEM_ERROR if there was not enough memory, or Z_STREAM_ERROR if the
+   stream state was inconsistent or an array is Z_NULL.
+*/
+
 /*
 ZEXTERN int ZEXPORT inflateBackInit OF((z_streamp strm, int windowBits,
                                         unsigned char FAR *window));
@@ -1134,7 +1578,9 @@ ZEXTERN uLong ZEXPORT zlibCompileFlags OF((void));
     Operation variations (changes in library functionality):
      20: PKZIP_BUG_WORKAROUND -- slightly more permissive inflate
      21: FASTEST -- deflate algorithm with only one, lowest compression level
-     22,23: 0 (reserved)
+     22: BIG_MEM -- one-shot deflate() uses the input as the window, at the
+         cost of twice the memory for the hash tables
+     23: 0 (reserved)
 
     The sprintf variant used by gzprintf (zero is best):
      24: 0 = vs*, 1 = s* -- 1 means limited to 20 arguments after the format
@@ -1231,9 +1677,20 @@ ZEXTERN gzFile ZEXPORT gzopen OF((const char *path, const char *mode));
    a strategy: 'f' for filtered data as in "wb6f", 'h' for Huffman-only
    compression as in "wb1h", 'R' for run-length encoding as in "wb1R", or 'F'
    for fixed code compression as in "wb9F".  (See the description of
-   deflateInit2 for more information about the strategy parameter.)  'T' will
-   request transparent writing or appending with no compression and not using
-   the gzip format.
+   deflateInit2 for more information about the strategy parameter.)  'S' will
+   request rsyncable output as in "wb6S", which is deflateRsyncable() with bits
+   equal to 12.  'T' will request transparent writing or appending with no
+   compression and not using the gzip format.
+
+     'B' will request blocked writing as in "wb6B", where the output is a
+   series of gzip members of at most 65280 uncompressed bytes each, with the
+   size of each member in an extra field, in the same format as BGZF.  The
+   output can be decompressed by gzip, and reading it with gzseek() can go
+   directly to the member with the requested offset.  'I' requests blocked
+   writing with an index of the members at the end of the file, so that the
+   reader does not need to look at each member header to find the offset.  The
+   index is written only if there are no more than 16374 members.  Any flush
+   ends the current member.  'S' is ignored when blocked writing.
 
      "a" can be used instead of "w" to request that the gzip stream that will
    be written be appended to the file.  "+" will result in an error, since
@@ -1434,8 +1891,11 @@ ZEXTERN z_off_t ZEXPORT gzseek OF((gzFile file,
    the value SEEK_END is not supported.
 
      If the file is opened for reading, this function is emulated but can be
-   extremely slow.  If the file is opened for writing, only forward seeks are
-   supported; gzseek then compresses a sequence of zeroes up to the new
+   extremely slow.  If the file was written in blocked mode (see gzopen), then
+   seeking goes directly to the member with the requested offset, using the
+   index at the end of the file if there is one, and decompresses at most one
+   member to get there.  If the file is opened for writing, only forward seeks
+   are supported; gzseek then compresses a sequence of zeroes up to the new
    starting position.
 
      gzseek returns the resulting offset location as measured in bytes from
@@ -1585,6 +2045,17 @@ ZEXTERN uLong ZEXPORT adler32 OF((uLong adler, const Bytef *buf, uInt len));
      if (adler != original_adler) error();
 */
 
+ZEXTERN uLong ZEXPORT adler32_copy OF((uLong adler, Bytef *dst,
+                                       const Bytef *buf, uInt len));
+/*
+     Copy the bytes buf[0..len-1] to dst[0..len-1] and return adler updated
+   with those bytes, the same as memcpy() followed by adler32().  This is
+   faster than the two separate passes for long buffers, since each piece of
+   the data is checksummed while it is still in the cache from the copy.  The
+   buffers must not overlap.  If buf is Z_NULL, nothing is copied and the
+   required initial value for the checksum is returned.
+*/
+
 /*
 ZEXTERN uLong ZEXPORT adler32_combine OF((uLong adler1, uLong adler2,
                                           z_off_t len2));
@@ -1597,6 +2068,21 @@ ZEXTERN uLong ZEXPORT adler32_combine OF((uLong adler1, uLong adler2,
    negative, the result has no meaning or utility.
 */
 
+/*
+ZEXTERN uLong ZEXPORT adler32_combine_gen OF((z_off_t len2));
+
+     Return the operator corresponding to length len2, to be used with
+   adler32_combine_op().
+*/
+
+ZEXTERN uLong ZEXPORT adler32_combine_op OF((uLong adler1, uLong adler2,
+                                             uLong op));
+/*
+     Give the same result as adler32_combine(), using op in place of len2.  op
+   is generated from len2 by adler32_combine_gen().  This saves reducing len2
+   modulo 65521 when the same len2 is used many times.
+*/
+
 ZEXTERN uLong ZEXPORT crc32   OF((uLong crc, const Bytef *buf, uInt len));
 /*
      Update a running CRC-32 with the bytes buf[0..len-1] and return the
@@ -1614,6 +2100,15 @@ ZEXTERN uLong ZEXPORT crc32   OF((uLong crc, const Bytef *buf, uInt len));
      if (crc != original_crc) error();
 */
 
+ZEXTERN uLong ZEXPORT crc32_copy OF((uLong crc, Bytef *dst,
+                                     const Bytef *buf, uInt len));
+/*
+     Copy the bytes buf[0..len-1] to dst[0..len-1] and return crc updated with
+   those bytes, the same as memcpy() followed by crc32(), but faster for long
+   buffers.  The buffers must not overlap.  If buf is Z_NULL, nothing is
+   copied and the required initial value for the crc is returned.
+*/
+
 /*
 ZEXTERN uLong ZEXPORT crc32_combine OF((uLong crc1, uLong crc2, z_off_t len2));
 
@@ -1624,6 +2119,21 @@ ZEXTERN uLong ZEXPORT crc32_combine OF((uLong crc1, uLong crc2, z_off_t len2));
    len2.
 */
 
+/*
+ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t len2));
+
+     Return the operator corresponding to length len2, to be used with
+   crc32_combine_op().
+*/
+
+ZEXTERN uLong ZEXPORT crc32_combine_op OF((uLong crc1, uLong crc2, uLong op));
+/*
+     Give the same result as crc32_combine(), using op in place of len2.  op
+   is generated from len2 by crc32_combine_gen().  This will be faster than
+   crc32_combine() if the generated op is used more than once, as when many
+   pieces of the same length are combined.
+*/
+
 
                         /* various hacks, don't look :) */
 
@@ -1695,6 +2205,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
    ZEXTERN z_off64_t ZEXPORT gzoffset64 OF((gzFile));
    ZEXTERN uLong ZEXPORT adler32_combine64 OF((uLong, uLong, z_off64_t));
    ZEXTERN uLong ZEXPORT crc32_combine64 OF((uLong, uLong, z_off64_t));
+   ZEXTERN uLong ZEXPORT adler32_combine_gen64 OF((z_off64_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen64 OF((z_off64_t));
 #endif
 
 #if !defined(ZLIB_INTERNAL) && defined(Z_WANT64)
@@ -1705,6 +2217,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
 #    define z_gzoffset z_gzoffset64
 #    define z_adler32_combine z_adler32_combine64
 #    define z_crc32_combine z_crc32_combine64
+#    define z_adler32_combine_gen z_adler32_combine_gen64
+#    define z_crc32_combine_gen z_crc32_combine_gen64
 #  else
 #    define gzopen gzopen64
 #    define gzseek gzseek64
@@ -1712,6 +2226,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
 #    define gzoffset gzoffset64
 #    define adler32_combine adler32_combine64
 #    define crc32_combine crc32_combine64
+#    define adler32_combine_gen adler32_combine_gen64
+#    define crc32_combine_gen crc32_combine_gen64
 #  endif
 #  ifndef Z_LARGE64
      ZEXTERN gzFile ZEXPORT gzopen64 OF((const char *, const char *));
@@ -1720,6 +2236,8 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
      ZEXTERN z_off_t ZEXPORT gzoffset64 OF((gzFile));
      ZEXTERN uLong ZEXPORT adler32_combine64 OF((uLong, uLong, z_off_t));
      ZEXTERN uLong ZEXPORT crc32_combine64 OF((uLong, uLong, z_off_t));
+     ZEXTERN uLong ZEXPORT adler32_combine_gen64 OF((z_off_t));
+     ZEXTERN uLong ZEXPORT crc32_combine_gen64 OF((z_off_t));
 #  endif
 #else
    ZEXTERN gzFile ZEXPORT gzopen OF((const char *, const char *));
@@ -1728,12 +2246,16 @@ ZEXTERN int ZEXPORT gzgetc_ OF((gzFile file));  /* backward compatibility */
    ZEXTERN z_off_t ZEXPORT gzoffset OF((gzFile));
    ZEXTERN uLong ZEXPORT adler32_combine OF((uLong, uLong, z_off_t));
    ZEXTERN uLong ZEXPORT crc32_combine OF((uLong, uLong, z_off_t));
+   ZEXTERN uLong ZEXPORT adler32_combine_gen OF((z_off_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t));
 #endif
 
 #else /* Z_SOLO */
 
    ZEXTERN uLong ZEXPORT adler32_combine OF((uLong, uLong, z_off_t));
    ZEXTERN uLong ZEXPORT crc32_combine OF((uLong, uLong, z_off_t));
+   ZEXTERN uLong ZEXPORT adler32_combine_gen OF((z_off_t));
+   ZEXTERN uLong ZEXPORT crc32_combine_gen OF((z_off_t));
 
 #endif /* !Z_SOLO */
 
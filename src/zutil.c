@@ -88,6 +88,9 @@ uLong ZEXPORT zlibCompileFlags()
 #ifdef FASTEST
     flags += 1L << 21;
 #endif
+#ifdef BIG_MEM
+    flags += 1L << 22;
+#endif
 #if defined(STDC) || defined(Z_HAVE_STDARG_H)
 #  ifdef NO_vsnprintf
     flags += 1L << 25;
@@ -182,8 +185,47 @@ void ZLIB_INTERNAL zmemzero(dest, len)
         *dest++ = 0;  /* ??? to be unrolled */
     } while (--len != 0);
 }
+
+voidpf ZLIB_INTERNAL zmemchr(buf, c, len)
+    const Bytef* buf;
+    int c;
+    uInt  len;
+{
+    for (; len; len--, buf++)
+        if (*buf == (Byte)c) return (voidpf)buf;
+    return Z_NULL;
+}
 #endif
 
+/* Write the n low bytes of val at next, most significant first, and return
+   the position after them.  n may exceed sizeof(uLong), giving zero bytes. */
+ZLIB_INTERNAL Bytef FAR *zputbe(next, val, n)
+    Bytef FAR *next;
+    uLong val;
+    int n;
+{
+    int k;
+
+    for (k = n - 1; k >= 0; k--) {
+        next[k] = (Bytef)(val & 0xff);
+        val >>= 8;
+    }
+    return next + n;
+}
+
+/* Read n bytes at *next, most significant first, and advance *next past
+   them.  Only the low bytes are kept if n exceeds sizeof(uLong). */
+uLong ZLIB_INTERNAL zgetbe(next, n)
+    const Bytef FAR * FAR *next;
+    int n;
+{
+    uLong val = 0;
+
+    while (n--)
+        val = (val << 8) + *(*next)++;
+    return val;
+}
+
 #ifndef Z_SOLO
 
 #ifdef SYS16BIT
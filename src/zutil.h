@@ -204,17 +204,24 @@ extern z_const char * const z_errmsg[10]; /* indexed by 2-zlib_error */
 #    define zmemcpy _fmemcpy
 #    define zmemcmp _fmemcmp
 #    define zmemzero(dest, len) _fmemset(dest, 0, len)
+#    define zmemchr _fmemchr
 #  else
 #    define zmemcpy memcpy
 #    define zmemcmp memcmp
 #    define zmemzero(dest, len) memset(dest, 0, len)
+#    define zmemchr memchr
 #  endif
 #else
    void ZLIB_INTERNAL zmemcpy OF((Bytef* dest, const Bytef* source, uInt len));
    int ZLIB_INTERNAL zmemcmp OF((const Bytef* s1, const Bytef* s2, uInt len));
    void ZLIB_INTERNAL zmemzero OF((Bytef* dest, uInt len));
+   voidpf ZLIB_INTERNAL zmemchr OF((const Bytef* buf, int c, uInt len));
 #endif
 
+/* big-endian fields of inflateSave() and deflateSave() checkpoints */
+ZLIB_INTERNAL Bytef FAR *zputbe OF((Bytef FAR *next, uLong val, int n));
+uLong ZLIB_INTERNAL zgetbe OF((const Bytef FAR * FAR *next, int n));
+
 /* Diagnostic functions */
 #ifdef DEBUG
 #  include <stdio.h>